@@ -12,13 +12,13 @@ public class InstanceDirector : ModuleRules
 			new string[]
 			{
 				"Core",
+				"CoreUObject",
 			}
 		);
 
 		PrivateDependencyModuleNames.AddRange(
 			new string[]
 			{
-				"CoreUObject",
 				"Engine",
 				"Slate",
 				"SlateCore",
@@ -27,5 +27,11 @@ public class InstanceDirector : ModuleRules
 				"DeveloperSettings"
 			}
 		);
+
+		if (Target.Platform == UnrealTargetPlatform.Win64)
+		{
+			// GetExtendedTcpTable, used to identify which process is connecting
+			PublicSystemLibraries.Add("iphlpapi.lib");
+		}
 	}
 }
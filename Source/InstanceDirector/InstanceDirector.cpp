@@ -2,6 +2,7 @@
 
 #include "InstanceDirector.h"
 #include "InstanceDirectorSettings.h"
+#include "InstanceDirectorSubsystem.h"
 #include "Sockets.h"
 #include "SocketSubsystem.h"
 #include "Interfaces/IPv4/IPv4Address.h"
@@ -10,21 +11,532 @@
 #include "Async/Async.h"
 #include "Framework/Application/SlateApplication.h"
 #include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Misc/ScopeLock.h"
 #include "HAL/PlatformApplicationMisc.h"
 #include "Misc/Paths.h"
 #include "HAL/FileManager.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UObjectHash.h"
+#include "Engine/AssetManager.h"
+#include "Engine/World.h"
+#include "Containers/Ticker.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
 
 #if PLATFORM_WINDOWS
 #include "Windows/AllowWindowsPlatformTypes.h"
+#include <winsock2.h>
 #include <windows.h>
+#include <iphlpapi.h>
 #include "Windows/HideWindowsPlatformTypes.h"
 #endif
 
+#if PLATFORM_LINUX
+#include <poll.h>
+#include <stdio.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
 #define LOCTEXT_NAMESPACE "FInstanceDirectorModule"
 
 DEFINE_LOG_CATEGORY(LogInstanceDirector);
 
+namespace InstanceDirectorIpc
+{
+	/** Single byte the primary writes back once a frame is decoded and queued. Broken or rejected frames get none. */
+	constexpr uint8 DeliveredAck = 1;
+
+	/** How long a duplicate waits for DeliveredAck before giving up and exiting anyway. */
+	constexpr float AckTimeoutSeconds = 1.f;
+
+#if PLATFORM_LINUX
+	/** Fills in an abstract Unix socket address: no file on disk, and the name is released when its process dies. */
+	void MakeAbstractAddress(const ANSICHAR* Name, sockaddr_un& OutAddr, socklen_t& OutAddrLen)
+	{
+		FMemory::Memzero(OutAddr);
+		OutAddr.sun_family = AF_UNIX;
+		FCStringAnsi::Strncpy(OutAddr.sun_path + 1, Name, sizeof(OutAddr.sun_path) - 1);
+		OutAddrLen = offsetof(sockaddr_un, sun_path) + 1 + FCStringAnsi::Strlen(OutAddr.sun_path + 1);
+	}
+
+	/**
+	 * Linux serves the IPC on "InstanceDirector.IPC.<Port>" instead of loopback TCP, so the listener
+	 * can identify senders with SO_PEERCRED rather than searching the connection table.
+	 */
+	void MakeAddress(int32 Port, sockaddr_un& OutAddr, socklen_t& OutAddrLen)
+	{
+		ANSICHAR Name[64];
+		FCStringAnsi::Snprintf(Name, sizeof(Name), "InstanceDirector.IPC.%d", Port);
+		MakeAbstractAddress(Name, OutAddr, OutAddrLen);
+	}
+
+	/** Connects to the primary's IPC socket. Returns -1 if nobody is listening. */
+	int Connect(int32 Port)
+	{
+		sockaddr_un Addr;
+		socklen_t AddrLen;
+		MakeAddress(Port, Addr, AddrLen);
+
+		const int Fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+		if (Fd >= 0 && connect(Fd, (sockaddr*)&Addr, AddrLen) == 0)
+		{
+			return Fd;
+		}
+		if (Fd >= 0)
+		{
+			close(Fd);
+		}
+		return -1;
+	}
+
+	bool SendAll(int Fd, const uint8* Data, int32 Len)
+	{
+		int32 Total = 0;
+		while (Total < Len)
+		{
+			const ssize_t Sent = send(Fd, Data + Total, Len - Total, MSG_NOSIGNAL);
+			if (Sent <= 0)
+			{
+				return false;
+			}
+			Total += (int32)Sent;
+		}
+		return true;
+	}
+#endif
+}
+
+namespace InstanceDirectorHandover
+{
+	/** Length prefix that marks a handover request ([int32 -1][int32 successor PID]) instead of arguments. */
+	constexpr int32 RequestLength = -1;
+
+	/** How long a successor waits for the primary to pass its listener. */
+	constexpr int32 TimeoutMs = 5000;
+
+#if PLATFORM_LINUX
+	/** Abstract Unix socket the successor listens on for the primary's listening socket. */
+	void MakeAddress(int32 SuccessorPid, sockaddr_un& OutAddr, socklen_t& OutAddrLen)
+	{
+		ANSICHAR Name[64];
+		FCStringAnsi::Snprintf(Name, sizeof(Name), "InstanceDirector.Handover.%d", SuccessorPid);
+		InstanceDirectorIpc::MakeAbstractAddress(Name, OutAddr, OutAddrLen);
+	}
+
+	void SetTimeouts(int Fd, int32 InTimeoutMs)
+	{
+		timeval Timeout;
+		Timeout.tv_sec = InTimeoutMs / 1000;
+		Timeout.tv_usec = (InTimeoutMs % 1000) * 1000;
+		setsockopt(Fd, SOL_SOCKET, SO_RCVTIMEO, &Timeout, sizeof(Timeout));
+		setsockopt(Fd, SOL_SOCKET, SO_SNDTIMEO, &Timeout, sizeof(Timeout));
+	}
+
+	/** True if the peer on a connected Unix socket runs as our user (and has ExpectedPid, if given). */
+	bool IsTrustedPeer(int Fd, int32 ExpectedPid)
+	{
+		ucred Cred;
+		socklen_t CredLen = sizeof(Cred);
+		if (getsockopt(Fd, SOL_SOCKET, SO_PEERCRED, &Cred, &CredLen) != 0)
+		{
+			return false;
+		}
+		return Cred.uid == getuid() && (ExpectedPid == 0 || Cred.pid == ExpectedPid);
+	}
+
+	/** [int32 Count] then [int32 Length][UTF-8] per redirect */
+	TArray<uint8> SerializeRedirects(const TArray<FString>& Redirects)
+	{
+		TArray<uint8> Payload;
+		const int32 Count = Redirects.Num();
+		Payload.Append((const uint8*)&Count, sizeof(int32));
+		for (const FString& Arguments : Redirects)
+		{
+			FTCHARToUTF8 Convert(*Arguments);
+			const int32 Len = Convert.Length();
+			Payload.Append((const uint8*)&Len, sizeof(int32));
+			Payload.Append((const uint8*)Convert.Get(), Len);
+		}
+		return Payload;
+	}
+
+	TArray<FString> DeserializeRedirects(const TArray<uint8>& Payload)
+	{
+		TArray<FString> Redirects;
+		int32 Offset = 0;
+		auto ReadInt = [&Payload, &Offset](int32& OutValue)
+		{
+			if (Offset + (int32)sizeof(int32) > Payload.Num())
+			{
+				return false;
+			}
+			FMemory::Memcpy(&OutValue, Payload.GetData() + Offset, sizeof(int32));
+			Offset += sizeof(int32);
+			return true;
+		};
+
+		int32 Count = 0;
+		if (!ReadInt(Count))
+		{
+			return Redirects;
+		}
+
+		for (int32 Index = 0; Index < Count; ++Index)
+		{
+			int32 Len = 0;
+			if (!ReadInt(Len) || Len < 0 || Offset + Len > Payload.Num())
+			{
+				UE_LOG(LogInstanceDirector, Error, TEXT("Malformed handover payload after %d redirect(s)."), Redirects.Num());
+				break;
+			}
+			FUTF8ToTCHAR Convert((const ANSICHAR*)Payload.GetData() + Offset, Len);
+			Redirects.Add(FString(Convert.Length(), Convert.Get()));
+			Offset += Len;
+		}
+		return Redirects;
+	}
+
+	/** Sends [int32 PayloadLen] carrying ListenFd as SCM_RIGHTS, then the payload. */
+	bool SendListener(int Channel, int ListenFd, const TArray<uint8>& Payload)
+	{
+		int32 PayloadLen = Payload.Num();
+		iovec Iov;
+		Iov.iov_base = &PayloadLen;
+		Iov.iov_len = sizeof(PayloadLen);
+
+		alignas(cmsghdr) char Control[CMSG_SPACE(sizeof(int))];
+		FMemory::Memzero(Control);
+
+		msghdr Msg;
+		FMemory::Memzero(Msg);
+		Msg.msg_iov = &Iov;
+		Msg.msg_iovlen = 1;
+		Msg.msg_control = Control;
+		Msg.msg_controllen = sizeof(Control);
+
+		cmsghdr* Header = CMSG_FIRSTHDR(&Msg);
+		Header->cmsg_level = SOL_SOCKET;
+		Header->cmsg_type = SCM_RIGHTS;
+		Header->cmsg_len = CMSG_LEN(sizeof(int));
+		FMemory::Memcpy(CMSG_DATA(Header), &ListenFd, sizeof(int));
+
+		if (sendmsg(Channel, &Msg, MSG_NOSIGNAL) != (ssize_t)sizeof(PayloadLen))
+		{
+			return false;
+		}
+		return InstanceDirectorIpc::SendAll(Channel, Payload.GetData(), Payload.Num());
+	}
+
+	/** Counterpart of SendListener. On success OutFd is a descriptor for the primary's listening socket. */
+	bool ReceiveListener(int Channel, int& OutFd, TArray<uint8>& OutPayload)
+	{
+		OutFd = -1;
+
+		int32 PayloadLen = 0;
+		iovec Iov;
+		Iov.iov_base = &PayloadLen;
+		Iov.iov_len = sizeof(PayloadLen);
+
+		alignas(cmsghdr) char Control[CMSG_SPACE(sizeof(int))];
+		msghdr Msg;
+		FMemory::Memzero(Msg);
+		Msg.msg_iov = &Iov;
+		Msg.msg_iovlen = 1;
+		Msg.msg_control = Control;
+		Msg.msg_controllen = sizeof(Control);
+
+		if (recvmsg(Channel, &Msg, MSG_WAITALL | MSG_CMSG_CLOEXEC) != (ssize_t)sizeof(PayloadLen))
+		{
+			return false;
+		}
+
+		for (cmsghdr* Header = CMSG_FIRSTHDR(&Msg); Header; Header = CMSG_NXTHDR(&Msg, Header))
+		{
+			if (Header->cmsg_level == SOL_SOCKET && Header->cmsg_type == SCM_RIGHTS)
+			{
+				FMemory::Memcpy(&OutFd, CMSG_DATA(Header), sizeof(int));
+			}
+		}
+
+		if (OutFd < 0 || PayloadLen < 0)
+		{
+			return false;
+		}
+
+		OutPayload.SetNumUninitialized(PayloadLen);
+		int32 Total = 0;
+		while (Total < PayloadLen)
+		{
+			const ssize_t Read = recv(Channel, OutPayload.GetData() + Total, PayloadLen - Total, 0);
+			if (Read <= 0)
+			{
+				close(OutFd);
+				OutFd = -1;
+				return false;
+			}
+			Total += (int32)Read;
+		}
+		return true;
+	}
+
+#endif
+}
+
+namespace InstanceDirectorPeer
+{
+	/** Parent of Pid, or 0 if it cannot be determined. A single query; no process list is walked. */
+	uint32 GetParentProcessId(uint32 Pid)
+	{
+#if PLATFORM_WINDOWS
+		// PROCESS_BASIC_INFORMATION; only InheritedFromUniqueProcessId is used
+		struct FProcessBasicInformation
+		{
+			LONG_PTR ExitStatus;
+			PVOID PebBaseAddress;
+			ULONG_PTR AffinityMask;
+			LONG_PTR BasePriority;
+			ULONG_PTR UniqueProcessId;
+			ULONG_PTR InheritedFromUniqueProcessId;
+		};
+		using FNtQueryInformationProcess = LONG (NTAPI*)(HANDLE, ULONG, PVOID, ULONG, PULONG);
+		static const FNtQueryInformationProcess NtQueryInformationProcess =
+			(FNtQueryInformationProcess)GetProcAddress(GetModuleHandleW(L"ntdll.dll"), "NtQueryInformationProcess");
+
+		HANDLE Process = NtQueryInformationProcess ? OpenProcess(PROCESS_QUERY_LIMITED_INFORMATION, FALSE, Pid) : nullptr;
+		if (!Process)
+		{
+			return 0;
+		}
+
+		FProcessBasicInformation Info;
+		ULONG InfoLen = 0;
+		const bool bQueried = NtQueryInformationProcess(Process, 0 /* ProcessBasicInformation */, &Info, sizeof(Info), &InfoLen) >= 0;
+		CloseHandle(Process);
+		return bQueried ? (uint32)Info.InheritedFromUniqueProcessId : 0;
+#elif PLATFORM_LINUX
+		ANSICHAR Path[64];#elif PLATFORM_LINUX
+		ANSICHAR Path[64];
+		FCStringAnsi::Snprintf(Path, sizeof(Path), "/proc/%u/stat", Pid);
+		FILE* Stat = fopen(Path, "r");
+		if (!Stat)
+		{
+			return 0;
+		}
+
+		// "pid (comm) state ppid ..." where comm may itself contain spaces or parentheses
+		ANSICHAR Line[512];
+		const bool bRead = fgets(Line, sizeof(Line), Stat) != nullptr;
+		fclose(Stat);
+
+		const ANSICHAR* CommEnd = bRead ? strrchr(Line, ')') : nullptr;
+		int ParentPid = 0;
+		if (!CommEnd || sscanf(CommEnd + 1, " %*c %d", &ParentPid) != 1)
+		{
+			return 0;
+		}
+		return (uint32)ParentPid;
+#else
+		return 0;
+#endif
+	}
+
+#if PLATFORM_WINDOWS
+	/**
+	 * Finds the process on the other end of a loopback connection to ListenPort, from the OS connection table.
+	 * Loopback TCP carries no peer credentials, so this is the only option for the Windows IPC.
+	 * Returns 0 if it cannot be determined.
+	 */
+	uint32 GetSenderProcessId(uint16 SenderPort, uint16 ListenPort, TArray<uint8>& ScratchBuffer)
+	{
+		// The sender's row has its ephemeral port as the local port and ours as the remote port
+		for (int32 Attempt = 0; Attempt < 2; ++Attempt)
+		{
+			ULONG Size = (ULONG)ScratchBuffer.Num();
+			const DWORD Result = GetExtendedTcpTable(ScratchBuffer.GetData(), &Size, 0, AF_INET, TCP_TABLE_OWNER_PID_CONNECTIONS, 0);
+			if (Result == ERROR_INSUFFICIENT_BUFFER)
+			{
+				// Reused across connections, so this only allocates while the table grows
+				ScratchBuffer.SetNumUninitialized((int32)Size + 1024);
+				continue;
+			}
+			if (Result != NO_ERROR)
+			{
+				return 0;
+			}
+
+			const MIB_TCPTABLE_OWNER_PID* Table = (const MIB_TCPTABLE_OWNER_PID*)ScratchBuffer.GetData();
+			for (DWORD Index = 0; Index < Table->dwNumEntries; ++Index)
+			{
+				const MIB_TCPROW_OWNER_PID& Row = Table->table[Index];
+				if (ntohs((u_short)Row.dwLocalPort) == SenderPort && ntohs((u_short)Row.dwRemotePort) == ListenPort)
+				{
+					return Row.dwOwningPid;
+				}
+			}
+			return 0;
+		}
+		return 0;
+	}
+#endif
+}
+
+/** The blocking reads and writes the frame reader needs, so FSockets and Linux Unix sockets share one path. */
+class FInstanceDirectorConnection
+{
+public:
+	virtual ~FInstanceDirectorConnection() = default;
+
+	/** Waits for readable data, but never past Deadline (in FPlatformTime::Seconds). */
+	virtual bool WaitForData(double Deadline) = 0;
+
+	/** Reads up to BufferSize bytes. OutBytesRead is 0 once the sender has closed. */
+	virtual bool Recv(uint8* Data, int32 BufferSize, int32& OutBytesRead) = 0;
+
+	virtual bool Send(const uint8* Data, int32 Count) = 0;
+};
+
+class FInstanceDirectorSocketConnection : public FInstanceDirectorConnection
+{
+public:
+	explicit FInstanceDirectorSocketConnection(FSocket& InSocket)
+		: Socket(InSocket)
+	{
+	}
+
+	virtual bool WaitForData(double Deadline) override
+	{
+		const double Remaining = Deadline - FPlatformTime::Seconds();
+		return Remaining > 0.0 && Socket.Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromSeconds(Remaining));
+	}
+
+	virtual bool Recv(uint8* Data, int32 BufferSize, int32& OutBytesRead) override
+	{
+		return Socket.Recv(Data, BufferSize, OutBytesRead);
+	}
+
+	virtual bool Send(const uint8* Data, int32 Count) override
+	{
+		int32 BytesSent = 0;
+		return Socket.Send(Data, Count, BytesSent) && BytesSent == Count;
+	}
+
+private:
+	FSocket& Socket;
+};
+
+#if PLATFORM_LINUX
+class FInstanceDirectorUnixConnection : public FInstanceDirectorConnection
+{
+public:
+	explicit FInstanceDirectorUnixConnection(int InFd)
+		: Fd(InFd)
+	{
+	}
+
+	virtual bool WaitForData(double Deadline) override
+	{
+		const double Remaining = Deadline - FPlatformTime::Seconds();
+		if (Remaining <= 0.0)
+		{
+			return false;
+		}
+
+		pollfd Poll;
+		Poll.fd = Fd;
+		Poll.events = POLLIN;
+		Poll.revents = 0;
+		return poll(&Poll, 1, FMath::Max(1, (int32)(Remaining * 1000.0))) == 1;
+	}
+
+	virtual bool Recv(uint8* Data, int32 BufferSize, int32& OutBytesRead) override
+	{
+		const ssize_t Read = recv(Fd, Data, BufferSize, 0);
+		OutBytesRead = Read > 0 ? (int32)Read : 0;
+		return Read >= 0;
+	}
+
+	virtual bool Send(const uint8* Data, int32 Count) override
+	{
+		return InstanceDirectorIpc::SendAll(Fd, Data, Count);
+	}
+
+private:
+	int Fd;
+};
+
+/**
+ * Accept loop for the Linux IPC socket. Like FTcpListener, connections are handled inline on this thread.
+ * Owns ListenFd; a successor that took it over through a handover holds its own descriptor.
+ */
+class FInstanceDirectorUnixListener : public FRunnable
+{
+public:
+	FInstanceDirectorUnixListener(int InListenFd, TFunction<void(int)> InOnAccepted)
+		: ListenFd(InListenFd)
+		, OnAccepted(MoveTemp(InOnAccepted))
+	{
+		Thread = FRunnableThread::Create(this, TEXT("InstanceDirectorListener"), 128 * 1024, TPri_Normal);
+	}
+
+	virtual ~FInstanceDirectorUnixListener() override
+	{
+		Stop();
+		if (Thread)
+		{
+			Thread->WaitForCompletion();
+			delete Thread;
+		}
+		close(ListenFd);
+	}
+
+	int GetListenFd() const { return ListenFd; }
+
+	virtual uint32 Run() override
+	{
+		while (!bStopping)
+		{
+			// Wake up every second so Stop is noticed, like FTcpListener's sleep time
+			pollfd Poll;
+			Poll.fd = ListenFd;
+			Poll.events = POLLIN;
+			Poll.revents = 0;
+			if (poll(&Poll, 1, 1000) != 1)
+			{
+				continue;
+			}
+
+			const int ClientFd = accept4(ListenFd, nullptr, nullptr, SOCK_CLOEXEC);
+			if (ClientFd >= 0)
+			{
+				// Takes ownership of ClientFd
+				OnAccepted(ClientFd);
+			}
+		}
+		return 0;
+	}
+
+	/** Stops accepting. Safe to call from the accept callback; the loop exits once it returns. */
+	virtual void Stop() override
+	{
+		bStopping = true;
+	}
+
+private:
+	int ListenFd;
+	TFunction<void(int)> OnAccepted;
+	FRunnableThread* Thread = nullptr;
+	std::atomic<bool> bStopping{false};
+};
+#endif
+
 FOnInstanceRedirected FInstanceDirectorModule::OnInstanceRedirected;
+TMap<FString, FOnInstanceDirectorPreload> FInstanceDirectorModule::PreloadRoutes;
+FRWLock FInstanceDirectorModule::PreloadRoutesLock;
 
 void FInstanceDirectorModule::StartupModule()
 {
@@ -67,6 +579,21 @@ void FInstanceDirectorModule::ShutdownModule()
 		delete InstanceListener;
 		InstanceListener = nullptr;
 	}
+
+#if PLATFORM_LINUX
+	if (UnixListener)
+	{
+		delete UnixListener;
+		UnixListener = nullptr;
+	}
+#endif
+
+	FTSTicker::GetCoreTicker().RemoveTicker(PreloadReleaseHandle);
+	FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+	PostLoadMapHandle.Reset();
+	RetainedPreloadObjects.Empty();
+	RetainedPreloadWorlds.Empty();
+	RetainedPreloadHandles.Empty();
 }
 
 FString FInstanceDirectorModule::GetRawCommandLine()
@@ -197,10 +724,29 @@ bool FInstanceDirectorModule::CheckSingleInstance()
 	}
 
 	const int32 Port = Settings->PortNumber;
-	FIPv4Endpoint Endpoint(FIPv4Address::InternalLoopback, Port);
 
 	UE_LOG(LogInstanceDirector, Log, TEXT("Attempting to bind to port %d"), Port);
 
+#if PLATFORM_LINUX
+	// Linux serves the IPC on an abstract Unix socket named after the port, so admission control can read the
+	// sender's PID with SO_PEERCRED. Like a port, the name can only be bound once and is released on exit.
+	sockaddr_un Addr;
+	socklen_t AddrLen;
+	InstanceDirectorIpc::MakeAddress(Port, Addr, AddrLen);
+
+	const int ListenFd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	const bool bBound = ListenFd >= 0 && bind(ListenFd, (sockaddr*)&Addr, AddrLen) == 0 && listen(ListenFd, 8) == 0;
+	if (bBound)
+	{
+		UnixListener = new FInstanceDirectorUnixListener(ListenFd, [this](int ClientFd) { HandleUnixConnection(ClientFd); });
+	}
+	else if (ListenFd >= 0)
+	{
+		close(ListenFd);
+	}
+#else
+	FIPv4Endpoint Endpoint(FIPv4Address::InternalLoopback, Port);
+
 	// Try to start a listener on the port
 	// IMPORTANT: Set bReusable to false to prevent multiple instances from binding to the same port!
 	InstanceListener = new FTcpListener(Endpoint, FTimespan::FromSeconds(1), false);
@@ -208,25 +754,35 @@ bool FInstanceDirectorModule::CheckSingleInstance()
 	// Bind the connection handler
 	InstanceListener->OnConnectionAccepted().BindRaw(this, &FInstanceDirectorModule::HandleConnectionAccepted);
 
-	if (InstanceListener->IsActive())
+	const bool bBound = InstanceListener->IsActive();
+	if (!bBound)
+	{
+		// Clean up the failed listener
+		delete InstanceListener;
+		InstanceListener = nullptr;
+	}
+#endif
+
+	if (bBound)
 	{
 		UE_LOG(LogInstanceDirector, Log, TEXT("Successfully bound to port %d"), Port);
 		// We successfully bound to the port, so we are the first instance.
 		return true;
 	}
-	else
+
+	UE_LOG(LogInstanceDirector, Log, TEXT("Failed to bind to port %d. Assuming another instance is running."), Port);
+
+	// Explicit handover: take over the running instance's listener instead of exiting
+	if (FParse::Param(FCommandLine::Get(), TEXT("InstanceDirectorHandover")) && RequestHandover(Port))
 	{
-		UE_LOG(LogInstanceDirector, Log, TEXT("Failed to bind to port %d. Assuming another instance is running."), Port);
-		// Failed to bind, likely because another instance is running.
-		// Notify the existing instance to bring it to front.
-		NotifyExistingInstance(Port);
-		
-		// Clean up the failed listener
-		delete InstanceListener;
-		InstanceListener = nullptr;
-		
-		return false;
+		return true;
 	}
+
+	// Failed to bind, likely because another instance is running.
+	// Notify the existing instance to bring it to front.
+	NotifyExistingInstance(Port);
+	
+	return false;
 }
 
 void FInstanceDirectorModule::NotifyExistingInstance(int32 Port)
@@ -240,6 +796,55 @@ void FInstanceDirectorModule::NotifyExistingInstance(int32 Port)
 	AllowSetForegroundWindow(ASFW_ANY);
 #endif
 
+#if PLATFORM_LINUX
+	// Same frame and reply as below, over the primary's Unix socket
+	int Fd = -1;
+	for (int32 Attempt = 0; Attempt < 3 && Fd < 0; ++Attempt)
+	{
+		Fd = InstanceDirectorIpc::Connect(Port);
+		if (Fd < 0)
+		{
+			UE_LOG(LogInstanceDirector, Warning, TEXT("Connection attempt %d failed. Retrying..."), Attempt + 1);
+			FPlatformProcess::Sleep(0.1f);
+		}
+	}
+
+	if (Fd < 0)
+	{
+		UE_LOG(LogInstanceDirector, Error, TEXT("Failed to connect to existing instance after retries."));
+		return;
+	}
+
+	UE_LOG(LogInstanceDirector, Log, TEXT("Connected to existing instance. Sending arguments."));
+
+	const FString CmdLine = GetRawCommandLine();
+	FTCHARToUTF8 Convert(*CmdLine);
+	const int32 Len = Convert.Length();
+	if (InstanceDirectorIpc::SendAll(Fd, (const uint8*)&Len, sizeof(Len)) && InstanceDirectorIpc::SendAll(Fd, (const uint8*)Convert.Get(), Len))
+	{
+		UE_LOG(LogInstanceDirector, Log, TEXT("Sent %d bytes of arguments: %s"), Len, *CmdLine);
+	}
+	else
+	{
+		UE_LOG(LogInstanceDirector, Error, TEXT("Failed to send arguments!"));
+	}
+
+	pollfd Poll;
+	Poll.fd = Fd;
+	Poll.events = POLLIN;
+	Poll.revents = 0;
+	uint8 Ack = 0;
+	if (poll(&Poll, 1, (int)(InstanceDirectorIpc::AckTimeoutSeconds * 1000.f)) == 1
+		&& recv(Fd, &Ack, sizeof(Ack), 0) == sizeof(Ack) && Ack == InstanceDirectorIpc::DeliveredAck)
+	{
+		UE_LOG(LogInstanceDirector, Log, TEXT("Existing instance accepted the redirect."));
+	}
+	else
+	{
+		UE_LOG(LogInstanceDirector, Warning, TEXT("Existing instance did not confirm the redirect; it may have been throttled or rejected."));
+	}
+	close(Fd);
+#else
 	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
 	if (SocketSubsystem)
 	{
@@ -303,8 +908,19 @@ void FInstanceDirectorModule::NotifyExistingInstance(int32 Port)
 
 				UE_LOG(LogInstanceDirector, Log, TEXT("Sent %d bytes of arguments: %s"), Len, *CmdLine);
 
-				// Give a small moment for data to be flushed before shutdown
-				FPlatformProcess::Sleep(0.05f);
+				// Wait for the primary to confirm it queued the redirect. This also keeps us alive while it
+				// looks up who we are for admission control.
+				uint8 Ack = 0;
+				int32 AckBytesRead = 0;
+				if (Socket->Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromSeconds(InstanceDirectorIpc::AckTimeoutSeconds))
+					&& Socket->Recv(&Ack, sizeof(Ack), AckBytesRead) && AckBytesRead == sizeof(Ack) && Ack == InstanceDirectorIpc::DeliveredAck)
+				{
+					UE_LOG(LogInstanceDirector, Log, TEXT("Existing instance accepted the redirect."));
+				}
+				else
+				{
+					UE_LOG(LogInstanceDirector, Warning, TEXT("Existing instance did not confirm the redirect; it may have been throttled or rejected."));
+				}
 			}
 			else
 			{
@@ -317,16 +933,86 @@ void FInstanceDirectorModule::NotifyExistingInstance(int32 Port)
 			SocketSubsystem->DestroySocket(Socket);
 		}
 	}
+#endif
 }
 
 bool FInstanceDirectorModule::HandleConnectionAccepted(FSocket* ClientSocket, const FIPv4Endpoint& ClientEndpoint)
 {
-	UE_LOG(LogInstanceDirector, Log, TEXT("Received connection from %s"), *ClientEndpoint.ToString());
-
 	// Ensure socket is blocking
 	ClientSocket->SetNonBlocking(false);
 
-	// We received a connection, which means a duplicate instance tried to start.
+	// Loopback TCP carries no peer credentials. Windows finds the sender in the connection table, only once
+	// the cheap checks have passed; elsewhere TCP senders share one bucket (Linux serves the IPC on a Unix socket).
+	auto ResolveLauncherPid = [this, &ClientEndpoint]() -> uint32
+	{
+#if PLATFORM_WINDOWS
+		const UInstanceDirectorSettings* Settings = GetSettings();
+		const uint32 SenderPid = InstanceDirectorPeer::GetSenderProcessId(ClientEndpoint.Port, (uint16)Settings->PortNumber, PeerLookupBuffer);
+		return SenderPid != 0 ? InstanceDirectorPeer::GetParentProcessId(SenderPid) : 0;
+#else
+		return 0;
+#endif
+	};
+
+	FInstanceDirectorSocketConnection Connection(*ClientSocket);
+	FString Arguments;
+	const bool bDecoded = ServeConnection(Connection, ResolveLauncherPid, ClientEndpoint.ToString(), Arguments);
+
+	// Clean up the socket manually since we are returning true
+	ClientSocket->Close();
+	ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(ClientSocket);
+
+	if (bDecoded)
+	{
+		DeliverRedirect(Arguments);
+	}
+
+	return true; // We took ownership and destroyed the socket
+}
+
+void FInstanceDirectorModule::HandleUnixConnection(int32 ClientFd)
+{
+#if PLATFORM_LINUX
+	// The kernel recorded who connected, so identifying the launcher is a getsockopt and one /proc read
+	ucred Cred;
+	socklen_t CredLen = sizeof(Cred);
+	const bool bHasCred = getsockopt(ClientFd, SOL_SOCKET, SO_PEERCRED, &Cred, &CredLen) == 0;
+
+	auto ResolveLauncherPid = [bHasCred, &Cred]() -> uint32
+	{
+		return bHasCred ? InstanceDirectorPeer::GetParentProcessId((uint32)Cred.pid) : 0;
+	};
+
+	FInstanceDirectorUnixConnection Connection(ClientFd);
+	FString Arguments;
+	const bool bDecoded = ServeConnection(Connection, ResolveLauncherPid, bHasCred ? FString::Printf(TEXT("PID %d"), Cred.pid) : FString(TEXT("unknown PID")), Arguments);
+	close(ClientFd);
+
+	if (bDecoded)
+	{
+		DeliverRedirect(Arguments);
+	}
+#endif
+}
+
+bool FInstanceDirectorModule::ServeConnection(FInstanceDirectorConnection& Connection, TFunctionRef<uint32()> ResolveLauncherPid, const FString& PeerName, FString& OutArguments)
+{
+	// Admission control runs before anything is read or allocated for this connection
+	if (!AdmitConnection(ResolveLauncherPid))
+	{
+		return false;
+	}
+
+	// One deadline for the whole frame, so a sender trickling bytes cannot hold the listener thread
+	// for longer than ReadTimeoutSeconds in total
+	const UInstanceDirectorSettings* Settings = GetSettings();
+	const double ReadDeadline = FPlatformTime::Seconds() + Settings->ReadTimeoutSeconds;
+
+	UE_LOG(LogInstanceDirector, Log, TEXT("Received connection from %s"), *PeerName);
+
+	bool bFrameDecoded = false;
+
+	// We received a connection, which means a duplicate instance tried to start.
 	
 	// Read command line arguments
 	int32 Len = 0;
@@ -338,8 +1024,15 @@ bool FInstanceDirectorModule::HandleConnectionAccepted(FSocket* ClientSocket, co
 	int32 TotalLengthBytesRead = 0;
 	while (TotalLengthBytesRead < sizeof(int32))
 	{
+		if (!Connection.WaitForData(ReadDeadline))
+		{
+			UE_LOG(LogInstanceDirector, Warning, TEXT("Timed out reading length from %s."), *PeerName);
+			++TimedOutConnections;
+			break;
+		}
+
 		int32 ChunkRead = 0;
-		if (ClientSocket->Recv((uint8*)&Len + TotalLengthBytesRead, sizeof(int32) - TotalLengthBytesRead, ChunkRead))
+		if (Connection.Recv((uint8*)&Len + TotalLengthBytesRead, sizeof(int32) - TotalLengthBytesRead, ChunkRead))
 		{
 			TotalLengthBytesRead += ChunkRead;
 			if (ChunkRead == 0)
@@ -359,7 +1052,26 @@ bool FInstanceDirectorModule::HandleConnectionAccepted(FSocket* ClientSocket, co
 	{
 		UE_LOG(LogInstanceDirector, Log, TEXT("Received length: %d"), Len);
 
-		if (Len > 0)
+		if (Len == InstanceDirectorHandover::RequestLength)
+		{
+			// Control frame, not a redirect. On success our listener now belongs to the successor.
+			HandleHandoverRequest(Connection, ReadDeadline);
+			--PendingRedirects;
+			return false;
+		}
+
+		const int32 MaxMessageLength = Settings->MaxMessageLength;
+		if (Len < 0 || Len > MaxMessageLength)
+		{
+			UE_LOG(LogInstanceDirector, Warning, TEXT("Rejecting message: length %d outside [0, %d]."), Len, MaxMessageLength);
+			++RejectedConnections;
+		}
+		else if (Len == 0)
+		{
+			// No arguments, just bring us to the front
+			bFrameDecoded = true;
+		}
+		else
 		{
 			TArray<uint8> Buffer;
 			Buffer.SetNumUninitialized(Len + 1); // +1 for null terminator safety
@@ -368,8 +1080,15 @@ bool FInstanceDirectorModule::HandleConnectionAccepted(FSocket* ClientSocket, co
 			int32 TotalBytesRead = 0;
 			while (TotalBytesRead < Len)
 			{
+				if (!Connection.WaitForData(ReadDeadline))
+				{
+					UE_LOG(LogInstanceDirector, Warning, TEXT("Timed out reading data from %s."), *PeerName);
+					++TimedOutConnections;
+					break;
+				}
+
 				int32 ChunkRead = 0;
-				if (ClientSocket->Recv(Buffer.GetData() + TotalBytesRead, Len - TotalBytesRead, ChunkRead))
+				if (Connection.Recv(Buffer.GetData() + TotalBytesRead, Len - TotalBytesRead, ChunkRead))
 				{
 					TotalBytesRead += ChunkRead;
 					if (ChunkRead == 0)
@@ -389,6 +1108,7 @@ bool FInstanceDirectorModule::HandleConnectionAccepted(FSocket* ClientSocket, co
 			{
 				Buffer[Len] = 0; // Null terminate
 				ReceivedArguments = FUTF8ToTCHAR((const char*)Buffer.GetData()).Get();
+				bFrameDecoded = true;
 				UE_LOG(LogInstanceDirector, Log, TEXT("Received arguments: %s"), *ReceivedArguments);
 			}
 			else
@@ -402,18 +1122,553 @@ bool FInstanceDirectorModule::HandleConnectionAccepted(FSocket* ClientSocket, co
 		UE_LOG(LogInstanceDirector, Error, TEXT("Failed to read length from socket. Read %d bytes."), TotalLengthBytesRead);
 	}
 
-	// Clean up the socket manually since we are returning true
-	ClientSocket->Close();
-	ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(ClientSocket);
+	// A broken frame must not steal focus or reach gameplay code
+	if (!bFrameDecoded)
+	{
+		--PendingRedirects;
+		return false;
+	}
+
+	// Confirm delivery so senders (and the stress tool) can tell a queued redirect from a dropped one.
+	// The caller queues it right after closing the connection.
+	Connection.Send(&InstanceDirectorIpc::DeliveredAck, sizeof(InstanceDirectorIpc::DeliveredAck));
+
+	OutArguments = MoveTemp(ReceivedArguments);
+	return true;
+}
+
+void FInstanceDirectorModule::DeliverRedirect(const FString& Arguments)
+{
+	// Get route assets loading before we queue the game thread work
+	if (bSpeculativePreloadEnabled && !Arguments.IsEmpty())
+	{
+		StartSpeculativePreload(Arguments);
+	}
 	
+	EnqueueRedirect(Arguments);
+}
+
+const UInstanceDirectorSettings* FInstanceDirectorModule::GetSettings() const
+{
+	return SettingsOverride ? SettingsOverride : GetDefault<UInstanceDirectorSettings>();
+}
+
+void FInstanceDirectorModule::EnqueueRedirect(const FString& Arguments)
+{
+	{
+		FScopeLock Lock(&QueuedRedirectsLock);
+		QueuedRedirects.Add(Arguments);
+	}
+
 	// We want to run this on the game thread
-	AsyncTask(ENamedThreads::GameThread, [this, ReceivedArguments]()
+	AsyncTask(ENamedThreads::GameThread, [this]()
+	{
+		DispatchQueuedRedirects();
+	});
+}
+
+void FInstanceDirectorModule::DispatchQueuedRedirects()
+{
+	TArray<FString> Redirects;
+	{
+		FScopeLock Lock(&QueuedRedirectsLock);
+		if (bHandedOver)
+		{
+			// A successor took these over
+			return;
+		}
+		if (!OnInstanceRedirected.IsBound())
+		{
+			// Too early to deliver (e.g. inherited at startup); the subsystem drains these once it binds
+			UE_CLOG(QueuedRedirects.Num() > 0, LogInstanceDirector, Verbose, TEXT("Holding %d redirect(s) until a listener binds."), QueuedRedirects.Num());
+			return;
+		}
+		Redirects = MoveTemp(QueuedRedirects);
+		QueuedRedirects.Reset();
+	}
+
+	for (const FString& Arguments : Redirects)
 	{
 		FocusWindow();
-		OnInstanceRedirected.Broadcast(ReceivedArguments);
+		OnInstanceRedirected.Broadcast(Arguments);
+		--PendingRedirects;
+	}
+}
+
+bool FInstanceDirectorModule::RequestHandover(int32 Port)
+{
+#if PLATFORM_LINUX
+	using namespace InstanceDirectorHandover;
+
+	const int32 OurPid = (int32)getpid();
+	UE_LOG(LogInstanceDirector, Log, TEXT("Requesting listener handover from the instance on port %d (our PID %d)."), Port, OurPid);
+
+	// Listen for the primary before asking it to yield
+	sockaddr_un Addr;
+	socklen_t AddrLen;
+	MakeAddress(OurPid, Addr, AddrLen);
+
+	const int Rendezvous = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (Rendezvous < 0 || bind(Rendezvous, (sockaddr*)&Addr, AddrLen) != 0 || listen(Rendezvous, 1) != 0)
+	{
+		UE_LOG(LogInstanceDirector, Error, TEXT("Failed to open handover socket. Error: %d"), errno);
+		if (Rendezvous >= 0)
+		{
+			close(Rendezvous);
+		}
+		return false;
+	}
+
+	// Send [RequestLength][PID] over the normal IPC socket
+	bool bRequestSent = false;
+	const int RequestFd = InstanceDirectorIpc::Connect(Port);
+	if (RequestFd >= 0)
+	{
+		const int32 Request[2] = { RequestLength, OurPid };
+		bRequestSent = InstanceDirectorIpc::SendAll(RequestFd, (const uint8*)Request, sizeof(Request));
+		close(RequestFd);
+	}
+
+	int Channel = -1;
+	if (bRequestSent)
+	{
+		pollfd Poll;
+		Poll.fd = Rendezvous;
+		Poll.events = POLLIN;
+		Poll.revents = 0;
+		if (poll(&Poll, 1, TimeoutMs) == 1)
+		{
+			Channel = accept4(Rendezvous, nullptr, nullptr, SOCK_CLOEXEC);
+		}
+	}
+	close(Rendezvous);
+
+	if (Channel < 0)
+	{
+		UE_LOG(LogInstanceDirector, Warning, TEXT("Running instance did not hand over its listener (is bAllowHandover enabled?)."));
+		return false;
+	}
+
+	SetTimeouts(Channel, TimeoutMs);
+
+	int ReceivedFd = -1;
+	TArray<uint8> Payload;
+	if (!IsTrustedPeer(Channel, 0) || !ReceiveListener(Channel, ReceivedFd, Payload))
+	{
+		UE_LOG(LogInstanceDirector, Error, TEXT("Handover failed while receiving the listener."));
+		close(Channel);
+		return false;
+	}
+
+	// Without the ack the primary keeps listening, so only start accepting once it has gone out
+	const uint8 Ack = 1;
+	if (send(Channel, &Ack, 1, MSG_NOSIGNAL) != 1)
+	{
+		close(Channel);
+		close(ReceivedFd);
+		return false;
+	}
+	close(Channel);
+
+	// The received descriptor is the primary's listening socket itself; serve it directly
+	UnixListener = new FInstanceDirectorUnixListener(ReceivedFd, [this](int ClientFd) { HandleUnixConnection(ClientFd); });
+
+	const TArray<FString> Inherited = DeserializeRedirects(Payload);
+	UE_LOG(LogInstanceDirector, Log, TEXT("Took over listener on port %d with %d pending redirect(s)."), Port, Inherited.Num());
+
+	for (const FString& Arguments : Inherited)
+	{
+		++PendingRedirects;
+		EnqueueRedirect(Arguments);
+	}
+	return true;
+#else
+	UE_LOG(LogInstanceDirector, Warning, TEXT("Listener handover is only supported on Linux."));
+	return false;
+#endif
+}
+
+bool FInstanceDirectorModule::HandleHandoverRequest(FInstanceDirectorConnection& Connection, double ReadDeadline)
+{
+	int32 SuccessorPid = 0;
+	int32 TotalBytesRead = 0;
+	while (TotalBytesRead < sizeof(int32))
+	{
+		int32 ChunkRead = 0;
+		if (!Connection.WaitForData(ReadDeadline)
+			|| !Connection.Recv((uint8*)&SuccessorPid + TotalBytesRead, sizeof(int32) - TotalBytesRead, ChunkRead)
+			|| ChunkRead == 0)
+		{
+			break;
+		}
+		TotalBytesRead += ChunkRead;
+	}
+
+	if (TotalBytesRead != sizeof(int32))
+	{
+		UE_LOG(LogInstanceDirector, Error, TEXT("Failed to read successor PID from handover request."));
+		return false;
+	}
+
+	const UInstanceDirectorSettings* Settings = GetSettings();
+	if (!Settings->bAllowHandover)
+	{
+		UE_LOG(LogInstanceDirector, Warning, TEXT("Ignoring handover request from PID %d: handover is disabled in settings."), SuccessorPid);
+		return false;
+	}
+
+#if PLATFORM_LINUX
+	using namespace InstanceDirectorHandover;
+
+	UE_LOG(LogInstanceDirector, Log, TEXT("Handover requested by PID %d."), SuccessorPid);
+
+	if (!UnixListener)
+	{
+		UE_LOG(LogInstanceDirector, Error, TEXT("Handover requested, but we are not serving the IPC socket for port %d."), Settings->PortNumber);
+		return false;
+	}
+	const int ListenFd = UnixListener->GetListenFd();
+
+	sockaddr_un Addr;
+	socklen_t AddrLen;
+	MakeAddress(SuccessorPid, Addr, AddrLen);
+
+	const int Channel = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+	if (Channel < 0 || connect(Channel, (sockaddr*)&Addr, AddrLen) != 0)
+	{
+		UE_LOG(LogInstanceDirector, Error, TEXT("Failed to reach successor PID %d. Error: %d"), SuccessorPid, errno);
+		if (Channel >= 0)
+		{
+			close(Channel);
+		}
+		return false;
+	}
+
+	// Only hand our socket to the process that asked for it, running as the same user
+	if (!IsTrustedPeer(Channel, SuccessorPid))
+	{
+		UE_LOG(LogInstanceDirector, Warning, TEXT("Refusing handover: peer credentials do not match PID %d."), SuccessorPid);
+		close(Channel);
+		return false;
+	}
+
+	SetTimeouts(Channel, TimeoutMs);
+
+	// Keep the game thread from dispatching what we are about to hand over
+	TArray<FString> HandedOver;
+	{
+		FScopeLock Lock(&QueuedRedirectsLock);
+		HandedOver = MoveTemp(QueuedRedirects);
+		QueuedRedirects.Reset();
+		bHandedOver = true;
+	}
+
+	uint8 Ack = 0;
+	const bool bConfirmed = SendListener(Channel, ListenFd, SerializeRedirects(HandedOver))
+		&& recv(Channel, &Ack, 1, MSG_WAITALL) == 1 && Ack == 1;
+	close(Channel);
+
+	if (!bConfirmed)
+	{
+		UE_LOG(LogInstanceDirector, Warning, TEXT("Successor PID %d did not confirm the handover. Keeping the listener."), SuccessorPid);
+		{
+			FScopeLock Lock(&QueuedRedirectsLock);
+			HandedOver.Append(MoveTemp(QueuedRedirects));
+			QueuedRedirects = MoveTemp(HandedOver);
+			bHandedOver = false;
+		}
+		AsyncTask(ENamedThreads::GameThread, [this]()
+		{
+			DispatchQueuedRedirects();
+		});
+		return false;
+	}
+
+	// The successor now shares the listening socket. We are on our accept loop's thread, so stopping it here
+	// means we never accept again; every new connection, including the backlog, goes to the successor.
+	UnixListener->Stop();
+
+	PendingRedirects -= HandedOver.Num();
+	UE_LOG(LogInstanceDirector, Log, TEXT("Handed listener and %d pending redirect(s) to PID %d. Exiting."), HandedOver.Num(), SuccessorPid);
+
+	AsyncTask(ENamedThreads::GameThread, [this]()
+	{
+		delete UnixListener;
+		UnixListener = nullptr;
+		FPlatformMisc::RequestExit(false);
 	});
+	return true;
+#else
+	UE_LOG(LogInstanceDirector, Warning, TEXT("Listener handover is only supported on Linux."));
+	return false;
+#endif
+}
 
-	return true; // We took ownership and destroyed the socket
+bool FInstanceDirectorModule::AdmitConnection(TFunctionRef<uint32()> ResolveLauncherPid)
+{
+	const UInstanceDirectorSettings* Settings = GetSettings();
+	if (!Settings->bEnableAdmissionControl)
+	{
+		++PendingRedirects;
+		++AdmittedConnections;
+		return true;
+	}
+
+	// Global cap on redirects that are being read or are still waiting for the game thread
+	if (PendingRedirects.load() >= Settings->MaxPendingRedirects)
+	{
+		++RejectedConnections;
+		UE_LOG(LogInstanceDirector, Verbose, TEXT("Rejected connection: %d redirects already pending."), PendingRedirects.load());
+		return false;
+	}
+
+	// Token bucket per launching process. Each duplicate is a new process, so the bucket is keyed by its
+	// parent: a looping launcher and a browser get separate budgets. The sender is only identified once the
+	// pending cap has passed. Unresolved senders (0) share one bucket. Buckets are only touched from the listener thread.
+	const uint32 LauncherPid = ResolveLauncherPid();
+
+	const double Now = FPlatformTime::Seconds();
+	const double Capacity = FMath::Max(1, Settings->SenderBurst);
+	const double RefillPerSecond = FMath::Max(0.f, Settings->SenderRefillPerSecond);
+
+	FSenderBucket* Bucket = SenderBuckets.Find(LauncherPid);
+	if (!Bucket)
+	{
+		// Drop buckets that have refilled completely; they carry no state worth keeping
+		if (SenderBuckets.Num() >= 256)
+		{
+			for (auto It = SenderBuckets.CreateIterator(); It; ++It)
+			{
+				if (It.Value().Tokens + (Now - It.Value().LastRefillSeconds) * RefillPerSecond >= Capacity)
+				{
+					It.RemoveCurrent();
+				}
+			}
+		}
+
+		Bucket = &SenderBuckets.Add(LauncherPid, FSenderBucket{ Capacity, Now });
+	}
+	else
+	{
+		Bucket->Tokens = FMath::Min(Capacity, Bucket->Tokens + (Now - Bucket->LastRefillSeconds) * RefillPerSecond);
+		Bucket->LastRefillSeconds = Now;
+	}
+
+	if (Bucket->Tokens < 1.0)
+	{
+		++ThrottledConnections;
+		UE_LOG(LogInstanceDirector, Verbose, TEXT("Throttled connection launched by PID %u."), LauncherPid);
+		return false;
+	}
+
+	Bucket->Tokens -= 1.0;
+	++PendingRedirects;
+	++AdmittedConnections;
+	return true;
+}
+
+FInstanceDirectorAdmissionStats FInstanceDirectorModule::GetAdmissionStats() const
+{
+	FInstanceDirectorAdmissionStats Stats;
+	Stats.Admitted = AdmittedConnections.load();
+	Stats.Throttled = ThrottledConnections.load();
+	Stats.Rejected = RejectedConnections.load();
+	Stats.TimedOut = TimedOutConnections.load();
+	Stats.PendingRedirects = PendingRedirects.load();
+	return Stats;
+}
+
+void FInstanceDirectorModule::RegisterPreloadRoute(const FString& Route, FOnInstanceDirectorPreload Handler)
+{
+	UE_LOG(LogInstanceDirector, Log, TEXT("Registering preload handler for route: %s"), *Route);
+	FWriteScopeLock Lock(PreloadRoutesLock);
+	PreloadRoutes.Add(Route, MoveTemp(Handler));
+}
+
+void FInstanceDirectorModule::UnregisterPreloadRoute(const FString& Route)
+{
+	FWriteScopeLock Lock(PreloadRoutesLock);
+	PreloadRoutes.Remove(Route);
+}
+
+void FInstanceDirectorModule::StartSpeculativePreload(const FString& RawArguments)
+{
+	const FString ParsedArgs = UInstanceDirectorSubsystem::ParseArguments(RawArguments);
+	if (ParsedArgs.IsEmpty())
+	{
+		return;
+	}
+
+	// Copy the handler out so it does not run under the lock
+	FOnInstanceDirectorPreload Handler;
+	{
+		FReadScopeLock Lock(PreloadRoutesLock);
+		if (const FOnInstanceDirectorPreload* Found = PreloadRoutes.Find(UInstanceDirectorSubsystem::GetRedirectRoute(ParsedArgs)))
+		{
+			Handler = *Found;
+		}
+	}
+
+	FInstanceDirectorPreloadSet PreloadSet;
+	if (!Handler.ExecuteIfBound(ParsedArgs, PreloadSet) || PreloadSet.IsEmpty())
+	{
+		return;
+	}
+
+	const uint32 Generation = ++PreloadGeneration;
+	UE_LOG(LogInstanceDirector, Log, TEXT("Preloading %d package(s) and %d primary asset(s) for: %s"),
+		PreloadSet.PackagePaths.Num(), PreloadSet.PrimaryAssetIds.Num(), *ParsedArgs);
+
+	auto RequestPackages = [this, Generation](const TArray<FString>& PackagePaths)
+	{
+		for (const FString& PackagePath : PackagePaths)
+		{
+			if (!FPackageName::IsValidLongPackageName(PackagePath))
+			{
+				UE_LOG(LogInstanceDirector, Warning, TEXT("Skipping invalid preload package path: %s"), *PackagePath);
+				continue;
+			}
+
+			// Completion is always delivered on the game thread
+			LoadPackageAsync(PackagePath, FLoadPackageAsyncDelegate::CreateLambda(
+				[this, Generation](const FName& PackageName, UPackage* Package, EAsyncLoadingResult::Type Result)
+				{
+					if (Result != EAsyncLoadingResult::Succeeded || !Package)
+					{
+						UE_LOG(LogInstanceDirector, Warning, TEXT("Preload of %s failed."), *PackageName.ToString());
+						return;
+					}
+
+					if (PrepareRetainedPreloads(Generation))
+					{
+						// Hold the top level objects for a short while; the package alone does not keep them
+						// from being collected. Worlds are also let go by the next map load, so one is never
+						// held past the travel it was loaded for.
+						TArray<UObject*> Objects;
+						GetObjectsWithPackage(Package, Objects, false);
+						for (UObject* Object : Objects)
+						{
+							if (Object->IsA<UWorld>())
+							{
+								RetainedPreloadWorlds.Emplace(Object);
+								if (!PostLoadMapHandle.IsValid())
+								{
+									PostLoadMapHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddRaw(this, &FInstanceDirectorModule::HandlePostLoadMap);
+								}
+							}
+							else
+							{
+								RetainedPreloadObjects.Emplace(Object);
+							}
+						}
+					}
+				}), TNumericLimits<int32>::Max());
+		}
+	};
+
+	// With a multithreaded async loader the request can be issued from this thread directly;
+	// otherwise it goes to the game thread ahead of the redirect broadcast queued after us.
+	if (IsAsyncLoadingMultithreaded())
+	{
+		RequestPackages(PreloadSet.PackagePaths);
+	}
+
+	// The Asset Manager is game thread only
+	AsyncTask(ENamedThreads::GameThread, [this, Generation, RequestPackages, PreloadSet = MoveTemp(PreloadSet)]()
+	{
+		if (!IsAsyncLoadingMultithreaded())
+		{
+			RequestPackages(PreloadSet.PackagePaths);
+		}
+
+		if (PreloadSet.PrimaryAssetIds.Num() > 0 && PrepareRetainedPreloads(Generation))
+		{
+			if (UAssetManager* AssetManager = UAssetManager::GetIfInitialized())
+			{
+				// Maps go through the package path, which releases the UWorld at the next map load.
+				// A streamable handle would hold it until the preload set expires.
+				TArray<FPrimaryAssetId> AssetIds;
+				TArray<FString> MapPackages;
+				for (const FPrimaryAssetId& AssetId : PreloadSet.PrimaryAssetIds)
+				{
+					if (AssetId.PrimaryAssetType == UAssetManager::MapType)
+					{
+						const FSoftObjectPath MapPath = AssetManager->GetPrimaryAssetPath(AssetId);
+						if (MapPath.IsValid())
+						{
+							MapPackages.Add(MapPath.GetLongPackageName());
+						}
+					}
+					else
+					{
+						AssetIds.Add(AssetId);
+					}
+				}
+
+				RequestPackages(MapPackages);
+
+				if (AssetIds.Num() > 0)
+				{
+					TSharedPtr<FStreamableHandle> Handle = AssetManager->LoadPrimaryAssets(AssetIds, PreloadSet.Bundles);
+					if (Handle.IsValid())
+					{
+						RetainedPreloadHandles.Add(Handle);
+					}
+				}
+			}
+			else
+			{
+				UE_LOG(LogInstanceDirector, Warning, TEXT("Asset Manager not initialized. Skipping primary asset preload."));
+			}
+		}
+	});
+}
+
+bool FInstanceDirectorModule::PrepareRetainedPreloads(uint32 Generation)
+{
+	check(IsInGameThread());
+
+	if (Generation < RetainedPreloadGeneration)
+	{
+		return false;
+	}
+
+	if (Generation > RetainedPreloadGeneration)
+	{
+		RetainedPreloadObjects.Empty();
+		RetainedPreloadWorlds.Empty();
+		RetainedPreloadHandles.Empty();
+		RetainedPreloadGeneration = Generation;
+
+		// Gameplay code reacts within moments of the redirect; after that the preload has done its job
+		FTSTicker::GetCoreTicker().RemoveTicker(PreloadReleaseHandle);
+		PreloadReleaseHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([this, Generation](float)
+		{
+			if (RetainedPreloadGeneration == Generation)
+			{
+				UE_LOG(LogInstanceDirector, Verbose, TEXT("Releasing preload set %u."), Generation);
+				RetainedPreloadObjects.Empty();
+				RetainedPreloadWorlds.Empty();
+				RetainedPreloadHandles.Empty();
+			}
+			PreloadReleaseHandle.Reset();
+			return false;
+		}), GetDefault<UInstanceDirectorSettings>()->PreloadRetainSeconds);
+	}
+	return true;
+}
+
+void FInstanceDirectorModule::HandlePostLoadMap(UWorld* LoadedWorld)
+{
+	// LoadMap has collected garbage and found the preloaded package by now, or travelled somewhere else
+	if (RetainedPreloadWorlds.Num() > 0)
+	{
+		UE_LOG(LogInstanceDirector, Verbose, TEXT("Map loaded. Releasing %d preloaded world(s)."), RetainedPreloadWorlds.Num());
+		RetainedPreloadWorlds.Empty();
+	}
+
+	FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+	PostLoadMapHandle.Reset();
 }
 
 void FInstanceDirectorModule::FocusWindow()
@@ -5,11 +5,57 @@
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
 #include "Common/TcpListener.h"
+#include "Interfaces/IPv4/IPv4Address.h"
+#include "UObject/PrimaryAssetId.h"
+#include "UObject/StrongObjectPtr.h"
+#include "Misc/ScopeRWLock.h"
+#include "Containers/Ticker.h"
+#include <atomic>
 
 DECLARE_LOG_CATEGORY_EXTERN(LogInstanceDirector, Log, All);
 
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnInstanceRedirected, const FString& /* Arguments */);
 
+/** Assets to start loading as soon as a redirect for a route is received. */
+struct FInstanceDirectorPreloadSet
+{
+	/** Long package names (e.g. "/Game/Maps/Lobby"). Loaded with LoadPackageAsync. */
+	TArray<FString> PackagePaths;
+
+	/** Primary assets loaded through the Asset Manager. */
+	TArray<FPrimaryAssetId> PrimaryAssetIds;
+
+	/** Bundles to load alongside PrimaryAssetIds. */
+	TArray<FName> Bundles;
+
+	bool IsEmpty() const { return PackagePaths.Num() == 0 && PrimaryAssetIds.Num() == 0; }
+};
+
+/** Listener admission counters. All values are totals since startup except PendingRedirects. */
+struct FInstanceDirectorAdmissionStats
+{
+	/** Connections that passed admission control. */
+	uint64 Admitted = 0;
+
+	/** Connections dropped because their sender ran out of tokens. */
+	uint64 Throttled = 0;
+
+	/** Connections dropped by the pending redirect cap, plus frames with an invalid length. */
+	uint64 Rejected = 0;
+
+	/** Admitted connections that stalled past ReadTimeoutSeconds. */
+	uint64 TimedOut = 0;
+
+	/** Redirects currently being read or waiting for the game thread. */
+	int32 PendingRedirects = 0;
+};
+
+/**
+ * Fills in the assets to preload for a parsed redirect (e.g. "join?id=123").
+ * Runs on the listener thread, so it must not touch UObjects or game state.
+ */
+DECLARE_DELEGATE_TwoParams(FOnInstanceDirectorPreload, const FString& /* Arguments */, FInstanceDirectorPreloadSet& /* OutPreloadSet */);
+
 class FInstanceDirectorModule : public IModuleInterface
 {
 public:
@@ -26,12 +72,121 @@ public:
 	/** Gets the raw command line from the OS */
 	static FString GetRawCommandLine();
 
+	/**
+	 * Registers a preload handler for a route (see UInstanceDirectorSubsystem::GetRedirectRoute).
+	 * The handler's assets start loading before the redirect is dispatched to the game thread.
+	 */
+	static void RegisterPreloadRoute(const FString& Route, FOnInstanceDirectorPreload Handler);
+
+	/** Removes the preload handler for a route. */
+	static void UnregisterPreloadRoute(const FString& Route);
+
+	/** Snapshot of the listener's admission control counters. Safe to call from any thread. */
+	FInstanceDirectorAdmissionStats GetAdmissionStats() const;
+
+	/**
+	 * Focuses the window and broadcasts every queued redirect. Game thread only.
+	 * Redirects stay queued while nothing is bound to OnInstanceRedirected, so call this after binding
+	 * to receive anything that arrived first (e.g. redirects inherited through a handover).
+	 */
+	void DispatchQueuedRedirects();
+
 private:
+	friend class FInstanceDirectorHandleConnectionTest;
+
 	bool CheckSingleInstance();
 	void NotifyExistingInstance(int32 Port);
 	bool HandleConnectionAccepted(class FSocket* ClientSocket, const struct FIPv4Endpoint& ClientEndpoint);
+
+	/** Linux counterpart of HandleConnectionAccepted for the Unix IPC socket. Takes ownership of ClientFd. */
+	void HandleUnixConnection(int32 ClientFd);
+
+	/** Admission, frame decoding and the delivery ack for one connection. Returns true with the decoded arguments. Listener thread only. */
+	bool ServeConnection(class FInstanceDirectorConnection& Connection, TFunctionRef<uint32()> ResolveLauncherPid, const FString& PeerName, FString& OutArguments);
+
+	/** Starts the route's preloads and queues a decoded redirect. */
+	void DeliverRedirect(const FString& Arguments);
+
+	/**
+	 * Cheap accept/reject decision made before any data is read. Listener thread only.
+	 * ResolveLauncherPid is only called once the pending cap has passed.
+	 */
+	bool AdmitConnection(TFunctionRef<uint32()> ResolveLauncherPid);
 	void FocusWindow();
 
+	/** Settings read by the connection path: the project settings unless SettingsOverride is set. */
+	const class UInstanceDirectorSettings* GetSettings() const;
+
+	/** Queues a decoded redirect and schedules DispatchQueuedRedirects on the game thread. */
+	void EnqueueRedirect(const FString& Arguments);
+
+	/** Asks the running primary to yield its listening socket and queued redirects. Returns true if we now own the listener. */
+	bool RequestHandover(int32 Port);
+
+	/** Passes our listening socket and queued redirects to a successor, then exits. Listener thread only. */
+	bool HandleHandoverRequest(class FInstanceDirectorConnection& Connection, double ReadDeadline);
+
+	/** Issues async loads for the route's preload set. Called on the listener thread. */
+	void StartSpeculativePreload(const FString& RawArguments);
+
+	/** Drops assets held for an older preload set and schedules release of the new one. Returns false if Generation is already stale. Game thread only. */
+	bool PrepareRetainedPreloads(uint32 Generation);
+
+	/** Releases preloaded worlds once a map has loaded. Game thread only. */
+	void HandlePostLoadMap(class UWorld* LoadedWorld);
+
+	/** IPC listener on Windows. */
 	class FTcpListener* InstanceListener = nullptr;
+
+	/** IPC listener on Linux, on an abstract Unix socket so senders can be identified with SO_PEERCRED. */
+	class FInstanceDirectorUnixListener* UnixListener = nullptr;
+
 	static FOnInstanceRedirected OnInstanceRedirected;
+
+	/** Redirects decoded on the listener thread, waiting for the game thread or for a listener to bind. */
+	FCriticalSection QueuedRedirectsLock;
+	TArray<FString> QueuedRedirects;
+
+	/** Replaces the project settings for admission and frame reading, so tests do not depend on the project's config. Not owned. */
+	const class UInstanceDirectorSettings* SettingsOverride = nullptr;
+
+	/** Cleared by tests so decoded redirects do not run the process-wide preload routes. */
+	bool bSpeculativePreloadEnabled = true;
+
+	/** Set once a successor owns our listener and queue. Nothing more is dispatched here. */
+	bool bHandedOver = false;
+
+	struct FSenderBucket
+	{
+		double Tokens;
+		double LastRefillSeconds;
+	};
+
+	/** Token buckets keyed by the sender's parent (launching) process; 0 for unresolved senders. Listener thread only. */
+	TMap<uint32, FSenderBucket> SenderBuckets;
+
+	/** Reused for GetExtendedTcpTable on Windows, so sender lookups only allocate while the table grows. */
+	TArray<uint8> PeerLookupBuffer;
+
+	std::atomic<int32> PendingRedirects{0};
+	std::atomic<uint64> AdmittedConnections{0};
+	std::atomic<uint64> ThrottledConnections{0};
+	std::atomic<uint64> RejectedConnections{0};
+	std::atomic<uint64> TimedOutConnections{0};
+
+	static TMap<FString, FOnInstanceDirectorPreload> PreloadRoutes;
+	static FRWLock PreloadRoutesLock;
+
+	/** Bumped for every redirect that has a preload set. Only the latest set is kept alive. */
+	std::atomic<uint32> PreloadGeneration{0};
+	uint32 RetainedPreloadGeneration = 0;
+	TArray<TStrongObjectPtr<UObject>> RetainedPreloadObjects;
+	TArray<TSharedPtr<struct FStreamableHandle>> RetainedPreloadHandles;
+
+	/** Preloaded map worlds. Kept so LoadMap's garbage collection does not purge them, then released by the next map load. */
+	TArray<TStrongObjectPtr<UObject>> RetainedPreloadWorlds;
+	FDelegateHandle PostLoadMapHandle;
+
+	/** Releases the retained preload set after PreloadRetainSeconds. */
+	FTSTicker::FDelegateHandle PreloadReleaseHandle;
 };
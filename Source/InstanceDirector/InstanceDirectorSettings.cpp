@@ -6,8 +6,17 @@ UInstanceDirectorSettings::UInstanceDirectorSettings()
 {
 	bEnableSingleInstanceCheck = true;
 	PortNumber = 64321;
+	MaxMessageLength = 64 * 1024;
+	bAllowHandover = false;
+
+	bEnableAdmissionControl = true;
+	SenderBurst = 5;
+	SenderRefillPerSecond = 2.f;
+	MaxPendingRedirects = 8;
+	ReadTimeoutSeconds = 2.f;
 	
 	URIScheme = TEXT("");
 	URISchemeFriendlyName = TEXT("Instance Director Application");
 	bRegisterURISchemeOnStartup = false;
+	PreloadRetainSeconds = 30.f;
 }
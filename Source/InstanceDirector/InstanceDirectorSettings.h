@@ -23,10 +23,49 @@ public:
 	UPROPERTY(Config, EditAnywhere, Category = "General")
 	bool bEnableSingleInstanceCheck;
 
-	/** The port number used to check for a running instance. Must be unique to this application. */
+	/** 
+	 * The port number used to check for a running instance. Must be unique to this application.
+	 * On Linux it names the abstract Unix socket "InstanceDirector.IPC.<Port>" instead of a TCP port.
+	 */
 	UPROPERTY(Config, EditAnywhere, Category = "General", meta = (ClampMin = "1024", ClampMax = "65535"))
 	int32 PortNumber;
 
+	/** Largest argument payload (in bytes) the listener will accept from another instance. Longer frames are dropped unread. */
+	UPROPERTY(Config, EditAnywhere, Category = "General", meta = (ClampMin = "256"))
+	int32 MaxMessageLength;
+
+	/**
+	 * If true, a newer build launched with -InstanceDirectorHandover can take over this instance's listening socket
+	 * and pending redirects, after which this instance exits. Linux only.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "General")
+	bool bAllowHandover;
+
+	// --- Admission Control Settings ---
+
+	/** If true, incoming connections are rate limited per sender and capped globally before any data is read. */
+	UPROPERTY(Config, EditAnywhere, Category = "Admission Control")
+	bool bEnableAdmissionControl;
+
+	/** 
+	 * Number of redirects one launching process may deliver back to back before being throttled.
+	 * Senders are grouped by their parent process, since every duplicate launch is a new process.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Admission Control", meta = (ClampMin = "1", EditCondition = "bEnableAdmissionControl"))
+	int32 SenderBurst;
+
+	/** Rate (per second) at which a throttled launching process earns back redirects. */
+	UPROPERTY(Config, EditAnywhere, Category = "Admission Control", meta = (ClampMin = "0.0", EditCondition = "bEnableAdmissionControl"))
+	float SenderRefillPerSecond;
+
+	/** Maximum redirects being read or waiting for the game thread at once. Further connections are closed unread. */
+	UPROPERTY(Config, EditAnywhere, Category = "Admission Control", meta = (ClampMin = "1", EditCondition = "bEnableAdmissionControl"))
+	int32 MaxPendingRedirects;
+
+	/** Total time a sender gets to deliver a whole message, measured from admission. Slower senders are dropped. */
+	UPROPERTY(Config, EditAnywhere, Category = "Admission Control", meta = (ClampMin = "0.1", Units = "s"))
+	float ReadTimeoutSeconds;
+
 	// --- Deep Linking Settings ---
 
 	/** 
@@ -50,4 +89,11 @@ public:
 	 */
 	UPROPERTY(Config, EditAnywhere, Category = "Deep Linking")
 	bool bRegisterURISchemeOnStartup;
+
+	/** 
+	 * How long assets preloaded for a deep link route are kept in memory after the link arrives.
+	 * Preloaded maps are released earlier, as soon as the next map finishes loading.
+	 */
+	UPROPERTY(Config, EditAnywhere, Category = "Deep Linking", meta = (ClampMin = "0.0", Units = "s"))
+	float PreloadRetainSeconds;
 };
@@ -2,6 +2,7 @@
 
 #include "InstanceDirectorSubsystem.h"
 #include "InstanceDirector.h"
+#include "InstanceDirectorSettings.h"
 #include "Misc/CommandLine.h"
 #include "Misc/Parse.h"
 
@@ -13,11 +14,28 @@ void UInstanceDirectorSubsystem::Initialize(FSubsystemCollectionBase& Collection
 
 	// Bind to the static delegate in the module
 	FInstanceDirectorModule::GetOnInstanceRedirected().AddUObject(this, &UInstanceDirectorSubsystem::HandleRedirect);
+
+	// The module holds redirects until something binds (e.g. ones inherited through a handover)
+	if (FInstanceDirectorModule* Module = FModuleManager::GetModulePtr<FInstanceDirectorModule>("InstanceDirector"))
+	{
+		Module->DispatchQueuedRedirects();
+	}
 }
 
 void UInstanceDirectorSubsystem::Deinitialize()
 {
 	UE_LOG(LogInstanceDirector, Log, TEXT("InstanceDirectorSubsystem Deinitialized."));
+
+	FInstanceDirectorModule::GetOnInstanceRedirected().RemoveAll(this);
+
+	// Release anyone still awaiting a redirect
+	TArray<int32> PendingWaitIds;
+	RedirectWaiters.GenerateKeyArray(PendingWaitIds);
+	for (int32 WaitId : PendingWaitIds)
+	{
+		CompleteRedirectWaiter(WaitId, EInstanceDirectorWaitStatus::Cancelled, FString());
+	}
+
 	Super::Deinitialize();
 }
 
@@ -28,14 +46,47 @@ void UInstanceDirectorSubsystem::HandleRedirect(const FString& Arguments)
 	FString ParsedArgs = ParseArguments(Arguments);
 	
 	// Only broadcast if we have something meaningful
-	if (!ParsedArgs.IsEmpty())
+	if (ParsedArgs.IsEmpty())
 	{
-		UE_LOG(LogInstanceDirector, Log, TEXT("Parsed Arguments: %s"), *ParsedArgs);
-		OnAppRedirected.Broadcast(ParsedArgs);
+		UE_LOG(LogInstanceDirector, Log, TEXT("Parsed arguments are empty. Ignoring."));
+		return;
 	}
-	else
+
+	UE_LOG(LogInstanceDirector, Log, TEXT("Parsed Arguments: %s"), *ParsedArgs);
+
+	const bool bHasListener = OnAppRedirected.IsBound() || RedirectWaiters.Num() > 0;
+
+	// Nobody has bound yet (we run before the game instance's Init), so keep it for CheckStartupArguments.
+	// Only during startup: a game that binds later, e.g. in one screen, should not be replayed old links.
+	if (bHoldingRedirects && !bHasListener)
 	{
-		UE_LOG(LogInstanceDirector, Log, TEXT("Parsed arguments are empty. Ignoring."));
+		const int32 MaxHeldRedirects = FMath::Max(1, GetDefault<UInstanceDirectorSettings>()->MaxPendingRedirects);
+		if (HeldRedirects.Num() >= MaxHeldRedirects)
+		{
+			UE_LOG(LogInstanceDirector, Warning, TEXT("Holding %d redirects already. Dropping the oldest: %s"), HeldRedirects.Num(), *HeldRedirects[0]);
+			HeldRedirects.RemoveAt(0);
+		}
+		HeldRedirects.Add(ParsedArgs);
+		return;
+	}
+
+	// Anything held from before a listener bound goes out first, in arrival order
+	if (bHoldingRedirects)
+	{
+		FlushHeldRedirects();
+	}
+	DispatchRedirect(ParsedArgs);
+}
+
+void UInstanceDirectorSubsystem::FlushHeldRedirects()
+{
+	bHoldingRedirects = false;
+
+	TArray<FString> Held = MoveTemp(HeldRedirects);
+	HeldRedirects.Reset();
+	for (const FString& HeldArgs : Held)
+	{
+		DispatchRedirect(HeldArgs);
 	}
 }
 
@@ -60,13 +111,155 @@ void UInstanceDirectorSubsystem::CheckStartupArguments()
 		if (!ParsedArgs.IsEmpty())
 		{
 			UE_LOG(LogInstanceDirector, Log, TEXT("Parsed Startup Arguments: %s"), *ParsedArgs);
-			OnAppRedirected.Broadcast(ParsedArgs);
+			DispatchRedirect(ParsedArgs);
 		}
 		else
 		{
 			UE_LOG(LogInstanceDirector, Log, TEXT("Parsed startup arguments are empty. Ignoring."));
 		}
 	}
+
+	// Redirects that arrived before the game was listening came after our own launch arguments
+	FlushHeldRedirects();
+}
+
+FString UInstanceDirectorSubsystem::GetRedirectRoute(const FString& Arguments)
+{
+	int32 End = 0;
+	while (End < Arguments.Len())
+	{
+		const TCHAR Char = Arguments[End];
+		if (Char == TEXT('/') || Char == TEXT('?') || Char == TEXT('#') || FChar::IsWhitespace(Char))
+		{
+			break;
+		}
+		++End;
+	}
+	return Arguments.Left(End);
+}
+
+TFuture<FInstanceDirectorWaitResult> UInstanceDirectorSubsystem::WaitForRedirect(const FString& Route, float TimeoutSeconds, int32* OutWaitId)
+{
+	TPromise<FInstanceDirectorWaitResult> Promise;
+	TFuture<FInstanceDirectorWaitResult> Future = Promise.GetFuture();
+
+	const int32 WaitId = AddRedirectWaiter(Route, TimeoutSeconds, [Promise = MoveTemp(Promise)](const FInstanceDirectorWaitResult& Result) mutable
+	{
+		Promise.SetValue(Result);
+	});
+
+	if (OutWaitId)
+	{
+		*OutWaitId = WaitId;
+	}
+	return Future;
+}
+
+int32 UInstanceDirectorSubsystem::AddRedirectWaiter(const FString& Route, float TimeoutSeconds, FOnInstanceDirectorWaitComplete OnComplete)
+{
+	// Waiters are dispatched and timed out on the game thread, so they are only ever touched there
+	check(IsInGameThread());
+
+	const int32 WaitId = NextWaitId++;
+	UE_LOG(LogInstanceDirector, Verbose, TEXT("Waiting for redirect on route '%s' (id %d, timeout %.2fs)"), *Route, WaitId, TimeoutSeconds);
+
+	FRedirectWaiter& Waiter = RedirectWaiters.Add(WaitId);
+	Waiter.Route = Route;
+	Waiter.OnComplete = MoveTemp(OnComplete);
+
+	// The core ticker runs without a world or game instance, so the timeout always applies
+	if (TimeoutSeconds > 0.f)
+	{
+		Waiter.TimeoutHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this, WaitId](float)
+		{
+			HandleRedirectWaitTimeout(WaitId);
+			return false;
+		}), TimeoutSeconds);
+	}
+
+	RedirectWaitersByRoute.FindOrAdd(Route).Add(WaitId);
+	return WaitId;
+}
+
+void UInstanceDirectorSubsystem::CancelRedirectWait(int32 WaitId)
+{
+	check(IsInGameThread());
+	CompleteRedirectWaiter(WaitId, EInstanceDirectorWaitStatus::Cancelled, FString());
+}
+
+void UInstanceDirectorSubsystem::HandleRedirectWaitTimeout(int32 WaitId)
+{
+	UE_LOG(LogInstanceDirector, Log, TEXT("Redirect wait %d timed out."), WaitId);
+	CompleteRedirectWaiter(WaitId, EInstanceDirectorWaitStatus::TimedOut, FString());
+}
+
+void UInstanceDirectorSubsystem::DispatchRedirect(const FString& ParsedArgs)
+{
+	OnAppRedirected.Broadcast(ParsedArgs);
+
+	if (RedirectWaiters.Num() == 0)
+	{
+		return;
+	}
+
+	// Take the matching buckets before completing anything, so callbacks that start a new wait
+	// for the same route are queued for the next redirect rather than this one.
+	TArray<int32> ReadyWaitIds;
+	const FString Route = GetRedirectRoute(ParsedArgs);
+	TSet<int32> RouteWaitIds;
+	if (RedirectWaitersByRoute.RemoveAndCopyValue(Route, RouteWaitIds))
+	{
+		ReadyWaitIds.Append(RouteWaitIds.Array());
+	}
+	if (!Route.IsEmpty())
+	{
+		TSet<int32> AnyRouteWaitIds;
+		if (RedirectWaitersByRoute.RemoveAndCopyValue(FString(), AnyRouteWaitIds))
+		{
+			ReadyWaitIds.Append(AnyRouteWaitIds.Array());
+		}
+	}
+
+	for (int32 WaitId : ReadyWaitIds)
+	{
+		CompleteRedirectWaiter(WaitId, EInstanceDirectorWaitStatus::Redirected, ParsedArgs);
+	}
+}
+
+void UInstanceDirectorSubsystem::CompleteRedirectWaiter(int32 WaitId, EInstanceDirectorWaitStatus Status, const FString& Arguments)
+{
+	FRedirectWaiter* Found = RedirectWaiters.Find(WaitId);
+	if (!Found)
+	{
+		return;
+	}
+
+	// The completion callback is move-only, so move it out before dropping the map entry
+	FRedirectWaiter Waiter = MoveTemp(*Found);
+	RedirectWaiters.Remove(WaitId);
+
+	if (Waiter.TimeoutHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(Waiter.TimeoutHandle);
+	}
+
+	// Redirected waiters were already taken out of their bucket by DispatchRedirect
+	if (Status != EInstanceDirectorWaitStatus::Redirected)
+	{
+		if (TSet<int32>* Bucket = RedirectWaitersByRoute.Find(Waiter.Route))
+		{
+			Bucket->Remove(WaitId);
+			if (Bucket->Num() == 0)
+			{
+				RedirectWaitersByRoute.Remove(Waiter.Route);
+			}
+		}
+	}
+
+	FInstanceDirectorWaitResult Result;
+	Result.Status = Status;
+	Result.Arguments = Arguments;
+	Waiter.OnComplete(Result);
 }
 
 FString UInstanceDirectorSubsystem::ParseArguments(const FString& CommandLine)
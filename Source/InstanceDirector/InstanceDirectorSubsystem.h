@@ -4,10 +4,31 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
 #include "InstanceDirectorSubsystem.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnAppRedirectedMCDelegate, FString, Arguments);
 
+/** How a wait started with UInstanceDirectorSubsystem::WaitForRedirect ended. */
+enum class EInstanceDirectorWaitStatus : uint8
+{
+	Redirected,
+	TimedOut,
+	Cancelled
+};
+
+/** Result of awaiting a routed redirect. Arguments is only set when Status is Redirected. */
+struct FInstanceDirectorWaitResult
+{
+	EInstanceDirectorWaitStatus Status = EInstanceDirectorWaitStatus::Cancelled;
+	FString Arguments;
+
+	bool WasRedirected() const { return Status == EInstanceDirectorWaitStatus::Redirected; }
+};
+
+using FOnInstanceDirectorWaitComplete = TUniqueFunction<void(const FInstanceDirectorWaitResult&)>;
+
 /**
  * Subsystem to handle Instance Director events.
  */
@@ -35,19 +56,81 @@ public:
 	/**
 	 * Checks the command line arguments used to launch this instance.
 	 * If arguments are found, it broadcasts the OnAppRedirected event.
+	 * Redirects that arrived before anything was listening are broadcast right after. Once this has run,
+	 * redirects are no longer held for listeners that bind later.
 	 * Call this in your GameInstance Init after binding to the event to handle cold starts (e.g. URI links).
 	 */
 	UFUNCTION(BlueprintCallable, Category = "Instance Director")
 	void CheckStartupArguments();
 
-private:
-	void HandleRedirect(const FString& Arguments);
-	
+	/**
+	 * Returns the route of a parsed redirect: everything before the first '/', '?', '#' or space.
+	 * e.g. "join?id=123" -> "join", "lobby/123" -> "lobby".
+	 */
+	UFUNCTION(BlueprintPure, Category = "Instance Director")
+	static FString GetRedirectRoute(const FString& Arguments);
+
 	/** 
 	 * Parses the raw command line to extract relevant arguments.
 	 * - If a Deep Link (://) is found, returns the suffix (e.g. "mygame://foo" -> "foo").
 	 * - If no Deep Link, returns the arguments excluding the executable path.
 	 * - If only executable path is present, returns empty string.
+	 * Pure string handling, so it is safe to call from the listener thread.
+	 */
+	static FString ParseArguments(const FString& CommandLine);
+
+	/**
+	 * Returns a future that completes with the next redirect whose route matches Route.
+	 * An empty Route matches any redirect. Game thread only.
+	 * The future is completed on the game thread, so continue with Next() or Then(). Blocking on Get() or
+	 * Wait() from the game thread deadlocks, since the redirect can never be dispatched.
+	 * @param TimeoutSeconds Completes with TimedOut after this long. Zero or less waits indefinitely.
+	 * @param OutWaitId Optional id that can be passed to CancelRedirectWait.
 	 */
-	FString ParseArguments(const FString& CommandLine);
+	TFuture<FInstanceDirectorWaitResult> WaitForRedirect(const FString& Route, float TimeoutSeconds = 0.f, int32* OutWaitId = nullptr);
+
+	/** Callback flavour of WaitForRedirect. Game thread only. OnComplete runs on the game thread. Returns the wait id. */
+	int32 AddRedirectWaiter(const FString& Route, float TimeoutSeconds, FOnInstanceDirectorWaitComplete OnComplete);
+
+	/** Completes a pending wait with Cancelled. Does nothing if the wait already finished. Game thread only. */
+	void CancelRedirectWait(int32 WaitId);
+
+private:
+	friend class FInstanceDirectorHeldRedirectsTest;
+	friend class FInstanceDirectorRedirectWaiterTest;
+
+	void HandleRedirect(const FString& Arguments);
+
+	/** Ends the startup window and dispatches the held redirects in arrival order. */
+	void FlushHeldRedirects();
+
+	/** Broadcasts OnAppRedirected and completes any waiters registered for the redirect's route. */
+	void DispatchRedirect(const FString& ParsedArgs);
+
+	void CompleteRedirectWaiter(int32 WaitId, EInstanceDirectorWaitStatus Status, const FString& Arguments);
+	void HandleRedirectWaitTimeout(int32 WaitId);
+	
+	struct FRedirectWaiter
+	{
+		FString Route;
+		FTSTicker::FDelegateHandle TimeoutHandle;
+		FOnInstanceDirectorWaitComplete OnComplete;
+	};
+
+	/** Pending waits by id, so cancellation and timeouts are a single lookup. */
+	TMap<int32, FRedirectWaiter> RedirectWaiters;
+
+	/** Wait ids bucketed by route, so a redirect only touches the waiters it completes and removing one is O(1). */
+	TMap<FString, TSet<int32>> RedirectWaitersByRoute;
+
+	int32 NextWaitId = 1;
+
+	/**
+	 * Redirects received during startup while nothing was listening. Delivered by CheckStartupArguments or the
+	 * first redirect that finds a listener. Capped at MaxPendingRedirects, dropping the oldest.
+	 */
+	TArray<FString> HeldRedirects;
+
+	/** True until CheckStartupArguments runs or a redirect finds a listener. Redirects are only held while set. */
+	bool bHoldingRedirects = true;
 };
@@ -0,0 +1,295 @@
+// Copyright SiddarthaG 2025. All Rights Reserved.
+
+#include "InstanceDirector.h"
+#include "InstanceDirectorSettings.h"
+#include "InstanceDirectorSubsystem.h"
+#include "Engine/GameInstance.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/ScopeLock.h"
+#include "Async/Async.h"
+#include "UObject/StrongObjectPtr.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInstanceDirectorHandleConnectionTest, "InstanceDirector.IPC.HandleConnectionAccepted",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FInstanceDirectorHandleConnectionTest::RunTest(const FString& Parameters)
+{
+	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+	if (!TestNotNull(TEXT("Socket subsystem"), SocketSubsystem))
+	{
+		return false;
+	}
+
+	// A private instance, so nothing reaches the running game. Queued dispatches capture it, so it is
+	// freed by a game thread task that runs after them.
+	FInstanceDirectorModule* Module = new FInstanceDirectorModule();
+
+	// Known settings rather than the project's: every test frame comes from this process, so admission
+	// control would put them all in one bucket. Preload routes are process-wide, so they are skipped too.
+	TStrongObjectPtr<UInstanceDirectorSettings> Settings(NewObject<UInstanceDirectorSettings>());
+	Settings->bEnableAdmissionControl = false;
+	Settings->MaxMessageLength = 64 * 1024;
+	Settings->ReadTimeoutSeconds = 2.f;
+	Module->SettingsOverride = Settings.Get();
+	Module->bSpeculativePreloadEnabled = false;
+
+	TSharedRef<FInternetAddr> ListenAddr = SocketSubsystem->CreateInternetAddr();
+	ListenAddr->SetIp(FIPv4Address::InternalLoopback.Value);
+	ListenAddr->SetPort(0);
+
+	FSocket* ListenSocket = SocketSubsystem->CreateSocket(NAME_Stream, TEXT("InstanceDirectorTestListener"), false);
+	if (!TestTrue(TEXT("Bind test listener"), ListenSocket && ListenSocket->Bind(*ListenAddr) && ListenSocket->Listen(8)))
+	{
+		SocketSubsystem->DestroySocket(ListenSocket);
+		delete Module;
+		return false;
+	}
+	ListenAddr->SetPort(ListenSocket->GetPortNo());
+
+	// Writes Frame from a fresh client, hands the accepted end to HandleConnectionAccepted and reports whether it acked
+	auto SendFrame = [&](const TArray<uint8>& Frame, bool bCloseAfterWrite) -> bool
+	{
+		FSocket* Client = SocketSubsystem->CreateSocket(NAME_Stream, TEXT("InstanceDirectorTestClient"), false);
+		bool bHasPending = false;
+		if (!Client->Connect(*ListenAddr) || !ListenSocket->WaitForPendingConnection(bHasPending, FTimespan::FromSeconds(1.0)) || !bHasPending)
+		{
+			AddError(TEXT("Could not connect to the test listener."));
+			SocketSubsystem->DestroySocket(Client);
+			return false;
+		}
+
+		FSocket* Accepted = ListenSocket->Accept(TEXT("InstanceDirectorTestAccepted"));
+		TSharedRef<FInternetAddr> PeerAddr = SocketSubsystem->CreateInternetAddr();
+		Accepted->GetPeerAddress(*PeerAddr);
+
+		int32 BytesSent = 0;
+		Client->Send(Frame.GetData(), Frame.Num(), BytesSent);
+		if (bCloseAfterWrite)
+		{
+			Client->Shutdown(ESocketShutdownMode::Write);
+		}
+
+		// Takes ownership of Accepted
+		TestTrue(TEXT("HandleConnectionAccepted owns the socket"), Module->HandleConnectionAccepted(Accepted, FIPv4Endpoint(PeerAddr)));
+
+		uint8 Ack = 0;
+		int32 BytesRead = 0;
+		const bool bAcked = Client->Wait(ESocketWaitConditions::WaitForRead, FTimespan::FromSeconds(1.0))
+			&& Client->Recv(&Ack, sizeof(Ack), BytesRead) && BytesRead == sizeof(Ack) && Ack == 1;
+
+		Client->Close();
+		SocketSubsystem->DestroySocket(Client);
+		return bAcked;
+	};
+
+	auto MakeFrame = [](int32 Length, const FString& Payload)
+	{
+		FTCHARToUTF8 Convert(*Payload);
+		TArray<uint8> Frame;
+		Frame.Append((const uint8*)&Length, sizeof(Length));
+		Frame.Append((const uint8*)Convert.Get(), Convert.Length());
+		return Frame;
+	};
+
+	auto GetQueued = [Module]()
+	{
+		FScopeLock Lock(&Module->QueuedRedirectsLock);
+		return Module->QueuedRedirects;
+	};
+
+	const FString Arguments = TEXT("\"Game.exe\" \"mygame://join?id=123\"");
+	const int32 ArgumentsLength = FTCHARToUTF8(*Arguments).Length();
+
+	// Normal frame: decoded, queued and acked
+	TestTrue(TEXT("Normal frame is acked"), SendFrame(MakeFrame(ArgumentsLength, Arguments), false));
+	const TArray<FString> Queued = GetQueued();
+	if (TestEqual(TEXT("Normal frame is queued"), Queued.Num(), 1))
+	{
+		TestEqual(TEXT("Queued arguments"), Queued[0], Arguments);
+	}
+
+	// Truncated frame: length promises more than arrives before the sender closes
+	AddExpectedMessage(TEXT("Connection closed prematurely"), ELogVerbosity::Warning, EAutomationExpectedMessageFlags::Contains, 1);
+	AddExpectedError(TEXT("Failed to read all bytes"), EAutomationExpectedErrorFlags::Contains, 1);
+	TestFalse(TEXT("Truncated frame is not acked"), SendFrame(MakeFrame(ArgumentsLength, Arguments.Left(4)), true));
+	TestEqual(TEXT("Truncated frame is not queued"), GetQueued().Num(), 1);
+
+	// Oversized frame: rejected from the length prefix alone
+	AddExpectedMessage(TEXT("Rejecting message"), ELogVerbosity::Warning, EAutomationExpectedMessageFlags::Contains, 1);
+	const uint64 RejectedBefore = Module->GetAdmissionStats().Rejected;
+	TestFalse(TEXT("Oversized frame is not acked"), SendFrame(MakeFrame(MAX_int32, Arguments), false));
+	TestEqual(TEXT("Oversized frame is not queued"), GetQueued().Num(), 1);
+	TestEqual(TEXT("Oversized frame counts as rejected"), Module->GetAdmissionStats().Rejected, RejectedBefore + 1);
+
+	// Only the queued redirect still holds a pending slot
+	TestEqual(TEXT("Pending redirects"), Module->GetAdmissionStats().PendingRedirects, 1);
+
+	ListenSocket->Close();
+	SocketSubsystem->DestroySocket(ListenSocket);
+	Module->SettingsOverride = nullptr;
+
+	// Drop what we queued so the scheduled dispatch broadcasts nothing
+	{
+		FScopeLock Lock(&Module->QueuedRedirectsLock);
+		Module->PendingRedirects -= Module->QueuedRedirects.Num();
+		Module->QueuedRedirects.Reset();
+	}
+	AsyncTask(ENamedThreads::GameThread, [Module]()
+	{
+		delete Module;
+	});
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInstanceDirectorHeldRedirectsTest, "InstanceDirector.Subsystem.HeldRedirects",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FInstanceDirectorHeldRedirectsTest::RunTest(const FString& Parameters)
+{
+	// Never initialized, so it is not bound to the module and only sees the redirects we hand it
+	UGameInstance* GameInstance = NewObject<UGameInstance>(GetTransientPackage());
+	UInstanceDirectorSubsystem* Subsystem = NewObject<UInstanceDirectorSubsystem>(GameInstance);
+
+	// Records every redirect through a wait on any route that restarts itself, like a bound listener
+	TArray<FString> Received;
+	int32 ListenWaitId = 0;
+	TFunction<void()> Listen;
+	Listen = [&]()
+	{
+		ListenWaitId = Subsystem->AddRedirectWaiter(FString(), 0.f, [&](const FInstanceDirectorWaitResult& Result)
+		{
+			if (Result.WasRedirected())
+			{
+				Received.Add(Result.Arguments);
+				Listen();
+			}
+		});
+	};
+
+	// Held while nobody listens, capped with the oldest dropped first
+	const int32 MaxHeldRedirects = FMath::Max(1, GetDefault<UInstanceDirectorSettings>()->MaxPendingRedirects);
+	AddExpectedMessage(TEXT("Dropping the oldest"), ELogVerbosity::Warning, EAutomationExpectedMessageFlags::Contains, 2);
+	for (int32 Index = 0; Index < MaxHeldRedirects + 2; ++Index)
+	{
+		Subsystem->HandleRedirect(FString::Printf(TEXT("Game.exe mygame://held/%d"), Index));
+	}
+	if (TestEqual(TEXT("Held redirects are capped"), Subsystem->HeldRedirects.Num(), MaxHeldRedirects))
+	{
+		TestEqual(TEXT("Oldest held redirects are dropped"), Subsystem->HeldRedirects[0], FString(TEXT("held/2")));
+	}
+
+	// The first redirect that finds a listener flushes the held ones ahead of itself, in arrival order
+	Listen();
+	Subsystem->HandleRedirect(TEXT("Game.exe mygame://live"));
+	TArray<FString> Expected;
+	for (int32 Index = 2; Index < MaxHeldRedirects + 2; ++Index)
+	{
+		Expected.Add(FString::Printf(TEXT("held/%d"), Index));
+	}
+	Expected.Add(TEXT("live"));
+	TestEqual(TEXT("Held redirects go out first, in order"), FString::Join(Received, TEXT(", ")), FString::Join(Expected, TEXT(", ")));
+
+	// The startup window is over, so a redirect with nobody listening is no longer held
+	Subsystem->CancelRedirectWait(ListenWaitId);
+	Subsystem->HandleRedirect(TEXT("Game.exe mygame://late"));
+	TestEqual(TEXT("Nothing is held after the first listener"), Subsystem->HeldRedirects.Num(), 0);
+
+	// CheckStartupArguments delivers the launch arguments, then the held redirects, and ends the window
+	Subsystem = NewObject<UInstanceDirectorSubsystem>(GameInstance);
+	Received.Reset();
+	Subsystem->HandleRedirect(TEXT("Game.exe mygame://first"));
+	Subsystem->HandleRedirect(TEXT("Game.exe mygame://second"));
+	Listen();
+	Subsystem->CheckStartupArguments();
+
+	Expected.Reset();
+	const FString LaunchArguments = UInstanceDirectorSubsystem::ParseArguments(FInstanceDirectorModule::GetRawCommandLine());
+	if (!LaunchArguments.IsEmpty())
+	{
+		Expected.Add(LaunchArguments);
+	}
+	Expected.Add(TEXT("first"));
+	Expected.Add(TEXT("second"));
+	TestEqual(TEXT("Launch arguments go out before held redirects"), FString::Join(Received, TEXT(", ")), FString::Join(Expected, TEXT(", ")));
+
+	Subsystem->CancelRedirectWait(ListenWaitId);
+	Subsystem->HandleRedirect(TEXT("Game.exe mygame://late"));
+	TestEqual(TEXT("Nothing is held after CheckStartupArguments"), Subsystem->HeldRedirects.Num(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FInstanceDirectorRedirectWaiterTest, "InstanceDirector.Subsystem.RedirectWaiters",
+	EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FInstanceDirectorRedirectWaiterTest::RunTest(const FString& Parameters)
+{
+	UGameInstance* GameInstance = NewObject<UGameInstance>(GetTransientPackage());
+	UInstanceDirectorSubsystem* Subsystem = NewObject<UInstanceDirectorSubsystem>(GameInstance);
+
+	// Every completion, by the name of the wait that received it
+	TMap<FString, TArray<FInstanceDirectorWaitResult>> Results;
+	auto Record = [&Results](const FString& Name) -> FOnInstanceDirectorWaitComplete
+	{
+		return [&Results, Name](const FInstanceDirectorWaitResult& Result)
+		{
+			Results.FindOrAdd(Name).Add(Result);
+		};
+	};
+	auto TestCompletedOnce = [this, &Results](const FString& Name, EInstanceDirectorWaitStatus Status, const FString& Arguments)
+	{
+		const TArray<FInstanceDirectorWaitResult>* Found = Results.Find(Name);
+		if (TestEqual(*FString::Printf(TEXT("%s completions"), *Name), Found ? Found->Num() : 0, 1))
+		{
+			TestTrue(*FString::Printf(TEXT("%s status"), *Name), (*Found)[0].Status == Status);
+			TestEqual(*FString::Printf(TEXT("%s arguments"), *Name), (*Found)[0].Arguments, Arguments);
+		}
+	};
+
+	// A route match and an empty route both complete; other routes keep waiting
+	const int32 JoinId = Subsystem->AddRedirectWaiter(TEXT("join"), 0.f, Record(TEXT("Join")));
+	Subsystem->AddRedirectWaiter(FString(), 0.f, Record(TEXT("Any")));
+	const int32 LobbyId = Subsystem->AddRedirectWaiter(TEXT("lobby"), 0.f, Record(TEXT("Lobby")));
+	Subsystem->DispatchRedirect(TEXT("join?id=123"));
+	TestCompletedOnce(TEXT("Join"), EInstanceDirectorWaitStatus::Redirected, TEXT("join?id=123"));
+	TestCompletedOnce(TEXT("Any"), EInstanceDirectorWaitStatus::Redirected, TEXT("join?id=123"));
+	TestFalse(TEXT("Other routes keep waiting"), Results.Contains(TEXT("Lobby")));
+
+	// Cancelling a finished wait does nothing
+	Subsystem->CancelRedirectWait(JoinId);
+	TestCompletedOnce(TEXT("Join"), EInstanceDirectorWaitStatus::Redirected, TEXT("join?id=123"));
+
+	Subsystem->CancelRedirectWait(LobbyId);
+	TestCompletedOnce(TEXT("Lobby"), EInstanceDirectorWaitStatus::Cancelled, FString());
+
+	// A redirect after the timeout finds nothing left to complete
+	const int32 TimeoutId = Subsystem->AddRedirectWaiter(TEXT("join"), 60.f, Record(TEXT("Timeout")));
+	Subsystem->HandleRedirectWaitTimeout(TimeoutId);
+	Subsystem->DispatchRedirect(TEXT("join?id=456"));
+	TestCompletedOnce(TEXT("Timeout"), EInstanceDirectorWaitStatus::TimedOut, FString());
+
+	// A callback that waits on the same route again gets the next redirect, not the current one
+	Subsystem->AddRedirectWaiter(TEXT("join"), 0.f, [&](const FInstanceDirectorWaitResult& Result)
+	{
+		Results.FindOrAdd(TEXT("First")).Add(Result);
+		Subsystem->AddRedirectWaiter(TEXT("join"), 0.f, Record(TEXT("Second")));
+	});
+	Subsystem->DispatchRedirect(TEXT("join/1"));
+	TestCompletedOnce(TEXT("First"), EInstanceDirectorWaitStatus::Redirected, TEXT("join/1"));
+	TestFalse(TEXT("Re-entrant wait skips the current redirect"), Results.Contains(TEXT("Second")));
+	Subsystem->DispatchRedirect(TEXT("join/2"));
+	TestCompletedOnce(TEXT("Second"), EInstanceDirectorWaitStatus::Redirected, TEXT("join/2"));
+
+	TestEqual(TEXT("No waits left"), Subsystem->RedirectWaiters.Num(), 0);
+	TestEqual(TEXT("No route buckets left"), Subsystem->RedirectWaitersByRoute.Num(), 0);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,91 @@
+// Copyright SiddarthaG 2025. All Rights Reserved.
+
+#include "InstanceDirectorWaitForRedirect.h"
+#include "InstanceDirector.h"
+#include "InstanceDirectorSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+
+UInstanceDirectorWaitForRedirect* UInstanceDirectorWaitForRedirect::WaitForRedirect(UObject* WorldContextObject, FString Route, float TimeoutSeconds)
+{
+	UInstanceDirectorWaitForRedirect* Action = NewObject<UInstanceDirectorWaitForRedirect>();
+	Action->Route = Route;
+	Action->TimeoutSeconds = TimeoutSeconds;
+
+	if (UWorld* World = GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::LogAndReturnNull))
+	{
+		if (UGameInstance* GameInstance = World->GetGameInstance())
+		{
+			Action->Subsystem = GameInstance->GetSubsystem<UInstanceDirectorSubsystem>();
+		}
+	}
+
+	Action->RegisterWithGameInstance(WorldContextObject);
+	return Action;
+}
+
+void UInstanceDirectorWaitForRedirect::Activate()
+{
+	UInstanceDirectorSubsystem* DirectorSubsystem = Subsystem.Get();
+	if (!DirectorSubsystem)
+	{
+		UE_LOG(LogInstanceDirector, Warning, TEXT("WaitForRedirect: No InstanceDirectorSubsystem available. Cancelling."));
+		Cancel();
+		return;
+	}
+
+	TWeakObjectPtr<UInstanceDirectorWaitForRedirect> WeakThis(this);
+	WaitId = DirectorSubsystem->AddRedirectWaiter(Route, TimeoutSeconds, [WeakThis](const FInstanceDirectorWaitResult& Result)
+	{
+		if (UInstanceDirectorWaitForRedirect* Action = WeakThis.Get())
+		{
+			Action->HandleWaitComplete(Result);
+		}
+	});
+}
+
+void UInstanceDirectorWaitForRedirect::Cancel()
+{
+	// Clear the id first so the Cancelled completion does not fire an output pin
+	const int32 PendingWaitId = WaitId;
+	WaitId = INDEX_NONE;
+
+	if (PendingWaitId != INDEX_NONE)
+	{
+		if (UInstanceDirectorSubsystem* DirectorSubsystem = Subsystem.Get())
+		{
+			DirectorSubsystem->CancelRedirectWait(PendingWaitId);
+		}
+	}
+
+	Super::Cancel();
+}
+
+bool UInstanceDirectorWaitForRedirect::IsActive() const
+{
+	return WaitId != INDEX_NONE;
+}
+
+void UInstanceDirectorWaitForRedirect::HandleWaitComplete(const FInstanceDirectorWaitResult& Result)
+{
+	if (WaitId == INDEX_NONE)
+	{
+		return;
+	}
+	WaitId = INDEX_NONE;
+
+	switch (Result.Status)
+	{
+	case EInstanceDirectorWaitStatus::Redirected:
+		OnRedirected.Broadcast(Result.Arguments);
+		break;
+	case EInstanceDirectorWaitStatus::TimedOut:
+		OnTimedOut.Broadcast(FString());
+		break;
+	case EInstanceDirectorWaitStatus::Cancelled:
+		break;
+	}
+
+	SetReadyToDestroy();
+}
@@ -0,0 +1,51 @@
+// Copyright SiddarthaG 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/CancellableAsyncAction.h"
+#include "InstanceDirectorWaitForRedirect.generated.h"
+
+class UInstanceDirectorSubsystem;
+struct FInstanceDirectorWaitResult;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FInstanceDirectorWaitForRedirectPin, FString, Arguments);
+
+/**
+ * Latent Blueprint node that waits for the next redirect on a route, with an optional timeout.
+ * Cancel the returned action to stop waiting; neither output pin fires after cancellation.
+ */
+UCLASS()
+class INSTANCEDIRECTOR_API UInstanceDirectorWaitForRedirect : public UCancellableAsyncAction
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Waits for the next redirect whose route matches Route (e.g. "join" matches "join?id=123").
+	 * @param Route The route to wait for. Leave empty to accept any redirect.
+	 * @param TimeoutSeconds Fires On Timed Out after this long. Zero or less waits indefinitely.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Instance Director", meta = (BlueprintInternalUseOnly = "true", WorldContext = "WorldContextObject"))
+	static UInstanceDirectorWaitForRedirect* WaitForRedirect(UObject* WorldContextObject, FString Route, float TimeoutSeconds = 0.f);
+
+	/** Fired with the parsed arguments when a matching redirect arrives. */
+	UPROPERTY(BlueprintAssignable)
+	FInstanceDirectorWaitForRedirectPin OnRedirected;
+
+	/** Fired with an empty string if no matching redirect arrived in time. */
+	UPROPERTY(BlueprintAssignable)
+	FInstanceDirectorWaitForRedirectPin OnTimedOut;
+
+	virtual void Activate() override;
+	virtual void Cancel() override;
+	virtual bool IsActive() const override;
+
+private:
+	void HandleWaitComplete(const FInstanceDirectorWaitResult& Result);
+
+	TWeakObjectPtr<UInstanceDirectorSubsystem> Subsystem;
+	FString Route;
+	float TimeoutSeconds = 0.f;
+	int32 WaitId = INDEX_NONE;
+};
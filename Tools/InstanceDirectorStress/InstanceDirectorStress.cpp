@@ -0,0 +1,974 @@
+// Copyright SiddarthaG 2025. All Rights Reserved.
+
+/**
+ * Headless load and stress harness for the Instance Director listener.
+ *
+ * Spawns concurrent senders that speak the same IPC protocol as NotifyExistingInstance
+ * ([int32 length][UTF-8 payload], answered by a one byte ack once the redirect is queued)
+ * against a running primary instance, or against an in-process stand-in listener that
+ * mirrors AdmitConnection + ServeConnection. Like the Linux plugin, both sides use the
+ * abstract Unix socket "InstanceDirector.IPC.<port>".
+ *
+ * A message only counts as delivered when its ack comes back. A connection the listener
+ * closes without an ack was throttled, rejected or dropped.
+ *
+ * Build (Linux):
+ *   c++ -std=c++17 -O2 -pthread InstanceDirectorStress.cpp -o InstanceDirectorStress
+ *
+ * Examples:
+ *   ./InstanceDirectorStress --self --no-admission --senders 64 --messages 200
+ *   ./InstanceDirectorStress --self --senders 8 --messages 20 --dispatch-us 2000
+ *   ./InstanceDirectorStress --port 64321 --pid <primary pid> --duration 10 --rate 500
+ *   ./InstanceDirectorStress --self --slow 10 --truncated 5 --oversized 5
+ *   ./InstanceDirectorStress --listen --port 64321
+ */
+
+#include <poll.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <chrono>
+#include <climits>
+#include <condition_variable>
+#include <csignal>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	using FClock = std::chrono::steady_clock;
+
+	/** Kind of frame a sender writes for a single connection. */
+	enum class EFrameKind
+	{
+		Normal,
+		SlowWriter,
+		Truncated,
+		Oversized
+	};
+
+	struct FOptions
+	{
+		int Port = 64321;
+		int Senders = 32;
+		int MessagesPerSender = 100;
+		double DurationSeconds = 0.0;
+		double TotalRate = 0.0;
+		int PayloadBytes = 0;
+		double SlowPercent = 0.0;
+		double TruncatedPercent = 0.0;
+		double OversizedPercent = 0.0;
+		int SlowWriteMs = 200;
+		int TimeoutMs = 5000;
+		int MaxMessageLength = 64 * 1024;
+
+		// Stand-in admission control, defaults match UInstanceDirectorSettings
+		bool bAdmission = true;
+		int SenderBurst = 5;
+		double SenderRefillPerSecond = 2.0;
+		int MaxPendingRedirects = 8;
+		int ReadTimeoutMs = 2000;
+		int DispatchUs = 0;
+
+		int TargetPid = 0;
+		bool bListen = false;
+		bool bSelf = false;
+	};
+
+	/** Per-sender counters; merged after all senders have joined. */
+	struct FSenderStats
+	{
+		uint64_t WellFormedSent = 0;
+		uint64_t WellFormedDelivered = 0;
+		uint64_t WellFormedRefused = 0;
+		uint64_t ConnectFailures = 0;
+		uint64_t SendFailures = 0;
+		uint64_t Timeouts = 0;
+		uint64_t FaultsSent = 0;
+		uint64_t FaultsClosedByPeer = 0;
+		uint64_t FaultsAcked = 0;
+		std::vector<double> ConnectLatencyUs;
+		std::vector<double> EndToEndLatencyUs;
+	};
+
+	/** Counters owned by the stand-in listener. */
+	struct FListenerStats
+	{
+		std::atomic<uint64_t> Accepted{0};
+		std::atomic<uint64_t> Throttled{0};
+		std::atomic<uint64_t> RejectedPending{0};
+		std::atomic<uint64_t> RejectedLength{0};
+		std::atomic<uint64_t> Truncated{0};
+		std::atomic<uint64_t> TimedOut{0};
+		std::atomic<uint64_t> Queued{0};
+		std::atomic<uint64_t> Delivered{0};
+	};
+
+	std::atomic<bool> GStopRequested{false};
+
+	void HandleSignal(int)
+	{
+		GStopRequested = true;
+	}
+
+	double ElapsedUs(FClock::time_point Start)
+	{
+		return std::chrono::duration<double, std::micro>(FClock::now() - Start).count();
+	}
+
+	void SetSocketTimeouts(int Fd, int TimeoutMs)
+	{
+		timeval Tv;
+		Tv.tv_sec = TimeoutMs / 1000;
+		Tv.tv_usec = (TimeoutMs % 1000) * 1000;
+		setsockopt(Fd, SOL_SOCKET, SO_RCVTIMEO, &Tv, sizeof(Tv));
+		setsockopt(Fd, SOL_SOCKET, SO_SNDTIMEO, &Tv, sizeof(Tv));
+	}
+
+	bool SendAll(int Fd, const uint8_t* Data, size_t Len)
+	{
+		size_t Total = 0;
+		while (Total < Len)
+		{
+			const ssize_t Sent = send(Fd, Data + Total, Len - Total, MSG_NOSIGNAL);
+			if (Sent <= 0)
+			{
+				if (Sent < 0 && errno == EINTR)
+				{
+					continue;
+				}
+				return false;
+			}
+			Total += static_cast<size_t>(Sent);
+		}
+		return true;
+	}
+
+	/** How the listener answered a frame. */
+	enum class EReply
+	{
+		Acked,
+		ClosedWithoutAck,
+		TimedOut,
+		Error
+	};
+
+	/** Waits for the listener's one byte ack, or for it to close the connection without one. */
+	EReply WaitForReply(int Fd)
+	{
+		uint8_t Ack = 0;
+		for (;;)
+		{
+			const ssize_t Read = recv(Fd, &Ack, sizeof(Ack), 0);
+			if (Read == 1)
+			{
+				return Ack == 1 ? EReply::Acked : EReply::Error;
+			}
+			if (Read == 0)
+			{
+				return EReply::ClosedWithoutAck;
+			}
+			if (errno == EINTR)
+			{
+				continue;
+			}
+			if (errno == EAGAIN || errno == EWOULDBLOCK)
+			{
+				return EReply::TimedOut;
+			}
+			// A reset before any ack means the listener dropped us without reading everything.
+			return errno == ECONNRESET ? EReply::ClosedWithoutAck : EReply::Error;
+		}
+	}
+
+	/** Milliseconds left until Deadline, clamped at zero. */
+	int RemainingMs(FClock::time_point Deadline)
+	{
+		const auto Left = std::chrono::duration_cast<std::chrono::milliseconds>(Deadline - FClock::now()).count();
+		return Left > 0 ? static_cast<int>(Left) : 0;
+	}
+
+	/** Reads exactly Len bytes before Deadline, like the plugin's WaitForDataBeforeDeadline loop. */
+	size_t RecvAllBeforeDeadline(int Fd, uint8_t* Data, size_t Len, FClock::time_point Deadline, bool& bOutTimedOut)
+	{
+		bOutTimedOut = false;
+		size_t Total = 0;
+		while (Total < Len)
+		{
+			pollfd Poll{ Fd, POLLIN, 0 };
+			const int Ready = poll(&Poll, 1, RemainingMs(Deadline));
+			if (Ready < 0 && errno == EINTR)
+			{
+				continue;
+			}
+			if (Ready <= 0)
+			{
+				bOutTimedOut = Ready == 0;
+				break;
+			}
+
+			const ssize_t Read = recv(Fd, Data + Total, Len - Total, 0);
+			if (Read <= 0)
+			{
+				if (Read < 0 && errno == EINTR)
+				{
+					continue;
+				}
+				break;
+			}
+			Total += static_cast<size_t>(Read);
+		}
+		return Total;
+	}
+
+	// --- Peer identity, as in InstanceDirectorPeer ---
+
+	/** Parent of Pid from /proc/<pid>/stat, or 0. */
+	uint32_t GetParentProcessId(uint32_t Pid)
+	{
+		std::ifstream Stat("/proc/" + std::to_string(Pid) + "/stat");
+		std::string Line;
+		if (!std::getline(Stat, Line))
+		{
+			return 0;
+		}
+		const size_t CommEnd = Line.rfind(')');
+		int ParentPid = 0;
+		if (CommEnd == std::string::npos || sscanf(Line.c_str() + CommEnd + 1, " %*c %d", &ParentPid) != 1)
+		{
+			return 0;
+		}
+		return static_cast<uint32_t>(ParentPid);
+	}
+
+	/** Abstract Unix socket address the plugin serves the IPC on, as in InstanceDirectorIpc::MakeAddress. */
+	socklen_t MakeAddress(int Port, sockaddr_un& OutAddr)
+	{
+		OutAddr = sockaddr_un{};
+		OutAddr.sun_family = AF_UNIX;
+		snprintf(OutAddr.sun_path + 1, sizeof(OutAddr.sun_path) - 1, "InstanceDirector.IPC.%d", Port);
+		return static_cast<socklen_t>(offsetof(sockaddr_un, sun_path) + 1 + strlen(OutAddr.sun_path + 1));
+	}
+
+	// --- Stand-in listener ---
+
+	/**
+	 * Mirrors FInstanceDirectorUnixListener + AdmitConnection + ServeConnection. A single accept thread
+	 * applies the pending redirect cap and a token bucket per launching process (SO_PEERCRED, then
+	 * the parent from /proc/<pid>/stat), then reads the
+	 * frame inline under one ReadTimeoutSeconds deadline. Decoded frames are acked and queued for
+	 * a dispatcher thread that stands in for the game thread.
+	 */
+	class FStandInListener
+	{
+	public:
+		explicit FStandInListener(const FOptions& InOptions)
+			: Options(InOptions)
+		{
+		}
+
+		~FStandInListener()
+		{
+			Stop();
+		}
+
+		bool Start()
+		{
+			ListenFd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+			if (ListenFd < 0)
+			{
+				perror("socket");
+				return false;
+			}
+
+			sockaddr_un Addr;
+			const socklen_t AddrLen = MakeAddress(Options.Port, Addr);
+
+			if (bind(ListenFd, reinterpret_cast<sockaddr*>(&Addr), AddrLen) != 0)
+			{
+				perror("bind");
+				close(ListenFd);
+				ListenFd = -1;
+				return false;
+			}
+
+			// The plugin listens with a backlog of 8.
+			if (listen(ListenFd, 8) != 0)
+			{
+				perror("listen");
+				close(ListenFd);
+				ListenFd = -1;
+				return false;
+			}
+
+			Dispatcher = std::thread([this]() { RunDispatcher(); });
+			Thread = std::thread([this]() { Run(); });
+			return true;
+		}
+
+		/** Stops accepting, then lets the dispatcher drain whatever was already queued. */
+		void Stop()
+		{
+			if (ListenFd >= 0)
+			{
+				bStopping = true;
+				if (Thread.joinable())
+				{
+					Thread.join();
+				}
+				close(ListenFd);
+				ListenFd = -1;
+
+				{
+					std::lock_guard<std::mutex> Lock(QueueMutex);
+					bDispatcherStopping = true;
+				}
+				QueueSignal.notify_one();
+				if (Dispatcher.joinable())
+				{
+					Dispatcher.join();
+				}
+			}
+		}
+
+		const FListenerStats& GetStats() const { return Stats; }
+
+	private:
+		struct FSenderBucket
+		{
+			double Tokens;
+			FClock::time_point LastRefill;
+		};
+
+		void Run()
+		{
+			while (!bStopping)
+			{
+				// Poll so Stop is noticed, like the plugin's accept loop
+				pollfd Poll{ ListenFd, POLLIN, 0 };
+				if (poll(&Poll, 1, 100) != 1)
+				{
+					continue;
+				}
+
+				const int ClientFd = accept4(ListenFd, nullptr, nullptr, SOCK_CLOEXEC);
+				if (ClientFd < 0)
+				{
+					if (errno == EINTR || errno == ECONNABORTED || errno == EAGAIN)
+					{
+						continue;
+					}
+					break;
+				}
+
+				++Stats.Accepted;
+				if (AdmitConnection(ClientFd))
+				{
+					HandleConnection(ClientFd);
+				}
+				close(ClientFd);
+			}
+		}
+
+		bool AdmitConnection(int ClientFd)
+		{
+			if (!Options.bAdmission)
+			{
+				++PendingRedirects;
+				return true;
+			}
+
+			if (PendingRedirects.load() >= Options.MaxPendingRedirects)
+			{
+				++Stats.RejectedPending;
+				return false;
+			}
+
+			ucred Cred{};
+			socklen_t CredLen = sizeof(Cred);
+			const bool bHasCred = getsockopt(ClientFd, SOL_SOCKET, SO_PEERCRED, &Cred, &CredLen) == 0;
+			const uint32_t LauncherPid = bHasCred ? GetParentProcessId(static_cast<uint32_t>(Cred.pid)) : 0;
+
+			const FClock::time_point Now = FClock::now();
+			const double Capacity = std::max(1, Options.SenderBurst);
+			const double RefillPerSecond = std::max(0.0, Options.SenderRefillPerSecond);
+
+			auto Found = SenderBuckets.find(LauncherPid);
+			if (Found == SenderBuckets.end())
+			{
+				Found = SenderBuckets.emplace(LauncherPid, FSenderBucket{ Capacity, Now }).first;
+			}
+			else
+			{
+				const double Elapsed = std::chrono::duration<double>(Now - Found->second.LastRefill).count();
+				Found->second.Tokens = std::min(Capacity, Found->second.Tokens + Elapsed * RefillPerSecond);
+				Found->second.LastRefill = Now;
+			}
+
+			if (Found->second.Tokens < 1.0)
+			{
+				++Stats.Throttled;
+				return false;
+			}
+
+			Found->second.Tokens -= 1.0;
+			++PendingRedirects;
+			return true;
+		}
+
+		void HandleConnection(int ClientFd)
+		{
+			const FClock::time_point Deadline = FClock::now() + std::chrono::milliseconds(Options.ReadTimeoutMs);
+			bool bTimedOut = false;
+
+			int32_t Len = 0;
+			if (RecvAllBeforeDeadline(ClientFd, reinterpret_cast<uint8_t*>(&Len), sizeof(Len), Deadline, bTimedOut) != sizeof(Len))
+			{
+				++(bTimedOut ? Stats.TimedOut : Stats.Truncated);
+				--PendingRedirects;
+				return;
+			}
+
+			if (Len < 0 || Len > Options.MaxMessageLength)
+			{
+				++Stats.RejectedLength;
+				--PendingRedirects;
+				return;
+			}
+
+			std::vector<uint8_t> Buffer(static_cast<size_t>(Len) + 1);
+			if (RecvAllBeforeDeadline(ClientFd, Buffer.data(), static_cast<size_t>(Len), Deadline, bTimedOut) != static_cast<size_t>(Len))
+			{
+				++(bTimedOut ? Stats.TimedOut : Stats.Truncated);
+				--PendingRedirects;
+				return;
+			}
+
+			const uint8_t Ack = 1;
+			SendAll(ClientFd, &Ack, sizeof(Ack));
+			++Stats.Queued;
+
+			{
+				std::lock_guard<std::mutex> Lock(QueueMutex);
+				++QueuedRedirects;
+			}
+			QueueSignal.notify_one();
+		}
+
+		/** Stands in for DispatchQueuedRedirects on the game thread: the pending slot is held until dispatch. */
+		void RunDispatcher()
+		{
+			std::unique_lock<std::mutex> Lock(QueueMutex);
+			for (;;)
+			{
+				QueueSignal.wait(Lock, [this]() { return QueuedRedirects > 0 || bDispatcherStopping; });
+				if (QueuedRedirects == 0)
+				{
+					return;
+				}
+
+				--QueuedRedirects;
+				Lock.unlock();
+				if (Options.DispatchUs > 0)
+				{
+					std::this_thread::sleep_for(std::chrono::microseconds(Options.DispatchUs));
+				}
+				--PendingRedirects;
+				++Stats.Delivered;
+				Lock.lock();
+			}
+		}
+
+		const FOptions& Options;
+		FListenerStats Stats;
+		int ListenFd = -1;
+		std::atomic<bool> bStopping{false};
+		std::thread Thread;
+
+		/** Only touched from the accept thread. */
+		std::map<uint32_t, FSenderBucket> SenderBuckets;
+		std::atomic<int> PendingRedirects{0};
+
+		std::mutex QueueMutex;
+		std::condition_variable QueueSignal;
+		uint64_t QueuedRedirects = 0;
+		bool bDispatcherStopping = false;
+		std::thread Dispatcher;
+	};
+
+	// --- Senders ---
+
+	std::string MakePayload(const FOptions& Options, int SenderIndex, uint64_t Sequence)
+	{
+		std::string Payload = "\"/opt/Game/Binaries/Linux/Game\" \"mygame://stress/"
+			+ std::to_string(SenderIndex) + "/" + std::to_string(Sequence) + "\"";
+		if (Options.PayloadBytes > 0 && static_cast<int>(Payload.size()) < Options.PayloadBytes)
+		{
+			Payload.append(static_cast<size_t>(Options.PayloadBytes) - Payload.size(), 'x');
+		}
+		return Payload;
+	}
+
+	EFrameKind PickFrameKind(const FOptions& Options, std::mt19937& Rng)
+	{
+		std::uniform_real_distribution<double> Dist(0.0, 100.0);
+		double Roll = Dist(Rng);
+
+		if ((Roll -= Options.SlowPercent) < 0.0)
+		{
+			return EFrameKind::SlowWriter;
+		}
+		if ((Roll -= Options.TruncatedPercent) < 0.0)
+		{
+			return EFrameKind::Truncated;
+		}
+		if ((Roll -= Options.OversizedPercent) < 0.0)
+		{
+			return EFrameKind::Oversized;
+		}
+		return EFrameKind::Normal;
+	}
+
+	/** Writes one frame of the requested kind. Returns false if the socket failed mid-write. */
+	bool WriteFrame(int Fd, EFrameKind Kind, const std::string& Payload, const FOptions& Options)
+	{
+		const int32_t Len = static_cast<int32_t>(Payload.size());
+		const uint8_t* Data = reinterpret_cast<const uint8_t*>(Payload.data());
+
+		switch (Kind)
+		{
+		case EFrameKind::Normal:
+		{
+			std::vector<uint8_t> Frame(sizeof(Len) + Payload.size());
+			memcpy(Frame.data(), &Len, sizeof(Len));
+			memcpy(Frame.data() + sizeof(Len), Data, Payload.size());
+			return SendAll(Fd, Frame.data(), Frame.size());
+		}
+
+		case EFrameKind::SlowWriter:
+		{
+			// Dribble the frame out in small chunks spread over SlowWriteMs.
+			if (!SendAll(Fd, reinterpret_cast<const uint8_t*>(&Len), sizeof(Len)))
+			{
+				return false;
+			}
+			const int Chunks = 4;
+			const size_t ChunkSize = (Payload.size() + Chunks - 1) / Chunks;
+			for (size_t Offset = 0; Offset < Payload.size(); Offset += ChunkSize)
+			{
+				std::this_thread::sleep_for(std::chrono::milliseconds(Options.SlowWriteMs / Chunks));
+				if (!SendAll(Fd, Data + Offset, std::min(ChunkSize, Payload.size() - Offset)))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		case EFrameKind::Truncated:
+		{
+			// Announce the full length but only deliver half of it, then close our side.
+			if (!SendAll(Fd, reinterpret_cast<const uint8_t*>(&Len), sizeof(Len))
+				|| !SendAll(Fd, Data, Payload.size() / 2))
+			{
+				return false;
+			}
+			shutdown(Fd, SHUT_WR);
+			return true;
+		}
+
+		case EFrameKind::Oversized:
+		{
+			// Claim a payload far beyond anything a command line can be.
+			const int32_t Huge = INT32_MAX;
+			if (!SendAll(Fd, reinterpret_cast<const uint8_t*>(&Huge), sizeof(Huge))
+				|| !SendAll(Fd, Data, Payload.size()))
+			{
+				return false;
+			}
+			shutdown(Fd, SHUT_WR);
+			return true;
+		}
+		}
+
+		return false;
+	}
+
+	void RunSender(const FOptions& Options, int SenderIndex, FClock::time_point Deadline, FSenderStats& Stats)
+	{
+		std::mt19937 Rng(static_cast<uint32_t>(SenderIndex * 7919 + 17));
+
+		sockaddr_un Addr;
+		const socklen_t AddrLen = MakeAddress(Options.Port, Addr);
+
+		const bool bTimed = Options.DurationSeconds > 0.0;
+		const auto Interval = Options.TotalRate > 0.0
+			? std::chrono::duration_cast<FClock::duration>(std::chrono::duration<double>(Options.Senders / Options.TotalRate))
+			: FClock::duration::zero();
+		FClock::time_point NextSend = FClock::now();
+
+		for (uint64_t Sequence = 0; !GStopRequested; ++Sequence)
+		{
+			if (bTimed ? FClock::now() >= Deadline : Sequence >= static_cast<uint64_t>(Options.MessagesPerSender))
+			{
+				break;
+			}
+
+			if (Interval != FClock::duration::zero())
+			{
+				std::this_thread::sleep_until(NextSend);
+				NextSend += Interval;
+			}
+
+			const EFrameKind Kind = PickFrameKind(Options, Rng);
+			const bool bWellFormed = Kind == EFrameKind::Normal || Kind == EFrameKind::SlowWriter;
+			if (bWellFormed)
+			{
+				++Stats.WellFormedSent;
+			}
+			else
+			{
+				++Stats.FaultsSent;
+			}
+
+			const int Fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+			if (Fd < 0)
+			{
+				++Stats.ConnectFailures;
+				continue;
+			}
+
+			SetSocketTimeouts(Fd, Options.TimeoutMs);
+
+			const FClock::time_point Start = FClock::now();
+			if (connect(Fd, reinterpret_cast<sockaddr*>(&Addr), AddrLen) != 0)
+			{
+				++Stats.ConnectFailures;
+				close(Fd);
+				continue;
+			}
+			Stats.ConnectLatencyUs.push_back(ElapsedUs(Start));
+
+			if (!WriteFrame(Fd, Kind, MakePayload(Options, SenderIndex, Sequence), Options))
+			{
+				++Stats.SendFailures;
+				close(Fd);
+				continue;
+			}
+
+			// The listener acks once the redirect is queued; anything else means it was not delivered.
+			const EReply Reply = WaitForReply(Fd);
+			if (Reply == EReply::TimedOut)
+			{
+				++Stats.Timeouts;
+			}
+			else if (Reply == EReply::Acked)
+			{
+				if (bWellFormed)
+				{
+					++Stats.WellFormedDelivered;
+					Stats.EndToEndLatencyUs.push_back(ElapsedUs(Start));
+				}
+				else
+				{
+					++Stats.FaultsAcked;
+				}
+			}
+			else if (Reply == EReply::ClosedWithoutAck)
+			{
+				++(bWellFormed ? Stats.WellFormedRefused : Stats.FaultsClosedByPeer);
+			}
+			else
+			{
+				++Stats.SendFailures;
+			}
+
+			close(Fd);
+		}
+	}
+
+	// --- Reporting ---
+
+	double Percentile(const std::vector<double>& Sorted, double P)
+	{
+		if (Sorted.empty())
+		{
+			return 0.0;
+		}
+		const size_t Index = std::min(Sorted.size() - 1, static_cast<size_t>(P / 100.0 * static_cast<double>(Sorted.size())));
+		return Sorted[Index];
+	}
+
+	void PrintLatency(const char* Label, std::vector<double>& Samples)
+	{
+		std::sort(Samples.begin(), Samples.end());
+		printf("%-22s p50 %9.1f us  p90 %9.1f us  p99 %9.1f us  p99.9 %9.1f us  max %9.1f us\n",
+			Label,
+			Percentile(Samples, 50.0),
+			Percentile(Samples, 90.0),
+			Percentile(Samples, 99.0),
+			Percentile(Samples, 99.9),
+			Samples.empty() ? 0.0 : Samples.back());
+	}
+
+	/** Peak resident set size in KiB: VmHWM of the target process, or our own if no PID was given. */
+	long PeakMemoryKiB(int Pid)
+	{
+		if (Pid <= 0)
+		{
+			rusage Usage{};
+			getrusage(RUSAGE_SELF, &Usage);
+			return Usage.ru_maxrss;
+		}
+
+		std::ifstream Status("/proc/" + std::to_string(Pid) + "/status");
+		std::string Line;
+		while (std::getline(Status, Line))
+		{
+			if (Line.compare(0, 6, "VmHWM:") == 0)
+			{
+				return strtol(Line.c_str() + 6, nullptr, 10);
+			}
+		}
+		return -1;
+	}
+
+	void PrintListenerStats(const FListenerStats& Stats)
+	{
+		printf("Listener               %llu accepted, %llu throttled, %llu rejected (pending cap), %llu rejected (length)\n",
+			static_cast<unsigned long long>(Stats.Accepted.load()),
+			static_cast<unsigned long long>(Stats.Throttled.load()),
+			static_cast<unsigned long long>(Stats.RejectedPending.load()),
+			static_cast<unsigned long long>(Stats.RejectedLength.load()));
+		printf("                       %llu truncated, %llu timed out, %llu queued, %llu delivered\n",
+			static_cast<unsigned long long>(Stats.Truncated.load()),
+			static_cast<unsigned long long>(Stats.TimedOut.load()),
+			static_cast<unsigned long long>(Stats.Queued.load()),
+			static_cast<unsigned long long>(Stats.Delivered.load()));
+	}
+
+	void PrintUsage(const char* Exe)
+	{
+		printf(
+			"Usage: %s [options]\n"
+			"  --port <n>             Listener port, naming InstanceDirector.IPC.<n> (default 64321, matches UInstanceDirectorSettings)\n"
+			"  --senders <n>          Concurrent sender threads (default 32)\n"
+			"  --messages <n>         Messages per sender (default 100, ignored with --duration)\n"
+			"  --duration <sec>       Run for a fixed time instead of a fixed message count\n"
+			"  --rate <msg/s>         Total target launch rate across all senders (default: unthrottled)\n"
+			"  --payload-bytes <n>    Pad payloads to at least n bytes\n"
+			"  --slow <pct>           Percentage of slow writers\n"
+			"  --slow-ms <ms>         Time a slow writer takes to dribble out its payload (default 200)\n"
+			"  --truncated <pct>      Percentage of frames cut short before the announced length\n"
+			"  --oversized <pct>      Percentage of frames announcing an INT32_MAX length\n"
+			"  --timeout <ms>         Socket send/receive timeout (default 5000)\n"
+			"  --max-length <n>       Stand-in listener payload cap (default 65536)\n"
+			"  --no-admission         Stand-in accepts everything, like bEnableAdmissionControl=false\n"
+			"  --burst <n>            Stand-in SenderBurst (default 5)\n"
+			"  --refill <n/s>         Stand-in SenderRefillPerSecond (default 2)\n"
+			"  --max-pending <n>      Stand-in MaxPendingRedirects (default 8)\n"
+			"  --read-timeout <ms>    Stand-in ReadTimeoutSeconds for a whole frame (default 2000)\n"
+			"  --dispatch-us <us>     Simulated game thread time per redirect (default 0)\n"
+			"  --pid <pid>            Report peak memory (VmHWM) of this process instead of our own\n"
+			"  --self                 Run an in-process stand-in listener and target it\n"
+			"  --listen               Only run the stand-in listener until interrupted\n",
+			Exe);
+	}
+
+	bool ParseOptions(int Argc, char** Argv, FOptions& Options)
+	{
+		for (int Index = 1; Index < Argc; ++Index)
+		{
+			const std::string Arg = Argv[Index];
+			auto NextValue = [&]() -> const char*
+			{
+				if (Index + 1 >= Argc)
+				{
+					fprintf(stderr, "Missing value for %s\n", Arg.c_str());
+					exit(2);
+				}
+				return Argv[++Index];
+			};
+
+			if (Arg == "--port") { Options.Port = atoi(NextValue()); }
+			else if (Arg == "--senders") { Options.Senders = std::max(1, atoi(NextValue())); }
+			else if (Arg == "--messages") { Options.MessagesPerSender = std::max(0, atoi(NextValue())); }
+			else if (Arg == "--duration") { Options.DurationSeconds = atof(NextValue()); }
+			else if (Arg == "--rate") { Options.TotalRate = atof(NextValue()); }
+			else if (Arg == "--payload-bytes") { Options.PayloadBytes = atoi(NextValue()); }
+			else if (Arg == "--slow") { Options.SlowPercent = atof(NextValue()); }
+			else if (Arg == "--slow-ms") { Options.SlowWriteMs = std::max(0, atoi(NextValue())); }
+			else if (Arg == "--truncated") { Options.TruncatedPercent = atof(NextValue()); }
+			else if (Arg == "--oversized") { Options.OversizedPercent = atof(NextValue()); }
+			else if (Arg == "--timeout") { Options.TimeoutMs = std::max(1, atoi(NextValue())); }
+			else if (Arg == "--max-length") { Options.MaxMessageLength = atoi(NextValue()); }
+			else if (Arg == "--no-admission") { Options.bAdmission = false; }
+			else if (Arg == "--burst") { Options.SenderBurst = std::max(1, atoi(NextValue())); }
+			else if (Arg == "--refill") { Options.SenderRefillPerSecond = std::max(0.0, atof(NextValue())); }
+			else if (Arg == "--max-pending") { Options.MaxPendingRedirects = std::max(0, atoi(NextValue())); }
+			else if (Arg == "--read-timeout") { Options.ReadTimeoutMs = std::max(0, atoi(NextValue())); }
+			else if (Arg == "--dispatch-us") { Options.DispatchUs = std::max(0, atoi(NextValue())); }
+			else if (Arg == "--pid") { Options.TargetPid = atoi(NextValue()); }
+			else if (Arg == "--self") { Options.bSelf = true; }
+			else if (Arg == "--listen") { Options.bListen = true; }
+			else
+			{
+				PrintUsage(Argv[0]);
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+int main(int Argc, char** Argv)
+{
+	FOptions Options;
+	if (!ParseOptions(Argc, Argv, Options))
+	{
+		return 2;
+	}
+
+	signal(SIGINT, HandleSignal);
+	signal(SIGTERM, HandleSignal);
+
+	if (Options.bListen)
+	{
+		FStandInListener Listener(Options);
+		if (!Listener.Start())
+		{
+			return 1;
+		}
+		printf("Stand-in listener on InstanceDirector.IPC.%d. Ctrl+C to stop.\n", Options.Port);
+		while (!GStopRequested)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(100));
+		}
+		Listener.Stop();
+
+		PrintListenerStats(Listener.GetStats());
+		printf("Peak memory            %ld KiB (this process)\n", PeakMemoryKiB(0));
+		return 0;
+	}
+
+	std::unique_ptr<FStandInListener> Listener;
+	if (Options.bSelf)
+	{
+		Listener = std::make_unique<FStandInListener>(Options);
+		if (!Listener->Start())
+		{
+			return 1;
+		}
+	}
+
+	std::vector<FSenderStats> PerSender(static_cast<size_t>(Options.Senders));
+	std::vector<std::thread> Threads;
+	Threads.reserve(PerSender.size());
+
+	const FClock::time_point Start = FClock::now();
+	const FClock::time_point Deadline = Start + std::chrono::duration_cast<FClock::duration>(std::chrono::duration<double>(Options.DurationSeconds));
+
+	for (int Index = 0; Index < Options.Senders; ++Index)
+	{
+		Threads.emplace_back(RunSender, std::cref(Options), Index, Deadline, std::ref(PerSender[static_cast<size_t>(Index)]));
+	}
+	for (std::thread& Thread : Threads)
+	{
+		Thread.join();
+	}
+
+	const double WallSeconds = ElapsedUs(Start) / 1e6;
+
+	FSenderStats Total;
+	for (FSenderStats& Stats : PerSender)
+	{
+		Total.WellFormedSent += Stats.WellFormedSent;
+		Total.WellFormedDelivered += Stats.WellFormedDelivered;
+		Total.WellFormedRefused += Stats.WellFormedRefused;
+		Total.ConnectFailures += Stats.ConnectFailures;
+		Total.SendFailures += Stats.SendFailures;
+		Total.Timeouts += Stats.Timeouts;
+		Total.FaultsSent += Stats.FaultsSent;
+		Total.FaultsClosedByPeer += Stats.FaultsClosedByPeer;
+		Total.FaultsAcked += Stats.FaultsAcked;
+		Total.ConnectLatencyUs.insert(Total.ConnectLatencyUs.end(), Stats.ConnectLatencyUs.begin(), Stats.ConnectLatencyUs.end());
+		Total.EndToEndLatencyUs.insert(Total.EndToEndLatencyUs.end(), Stats.EndToEndLatencyUs.begin(), Stats.EndToEndLatencyUs.end());
+	}
+
+	// connect() completes once the kernel queues the connection, before the listener has seen it, so it
+	// measures the handshake rate only. Acks are what the listener actually got through.
+	const uint64_t Connected = Total.ConnectLatencyUs.size();
+	const uint64_t Acked = Total.WellFormedDelivered + Total.FaultsAcked;
+
+	printf("Target                 InstanceDirector.IPC.%d%s\n", Options.Port, Options.bSelf ? " (stand-in)" : "");
+	printf("Senders                %d, wall time %.2f s\n", Options.Senders, WallSeconds);
+	printf("Delivered throughput   %.1f msg/s (%llu acked)\n", Acked / WallSeconds, static_cast<unsigned long long>(Acked));
+	printf("Handshake rate         %.1f conn/s (%llu connect() completions)\n", Connected / WallSeconds, static_cast<unsigned long long>(Connected));
+	printf("Well-formed messages   %llu sent, %llu delivered (acked), %llu refused (closed without ack), %llu lost\n",
+		static_cast<unsigned long long>(Total.WellFormedSent),
+		static_cast<unsigned long long>(Total.WellFormedDelivered),
+		static_cast<unsigned long long>(Total.WellFormedRefused),
+		static_cast<unsigned long long>(Total.WellFormedSent - Total.WellFormedDelivered - Total.WellFormedRefused));
+	printf("Failures               %llu connect, %llu send/reset, %llu timed out\n",
+		static_cast<unsigned long long>(Total.ConnectFailures),
+		static_cast<unsigned long long>(Total.SendFailures),
+		static_cast<unsigned long long>(Total.Timeouts));
+	printf("Injected faults        %llu sent, %llu closed by listener, %llu wrongly acked\n",
+		static_cast<unsigned long long>(Total.FaultsSent),
+		static_cast<unsigned long long>(Total.FaultsClosedByPeer),
+		static_cast<unsigned long long>(Total.FaultsAcked));
+	PrintLatency("Connect latency", Total.ConnectLatencyUs);
+	PrintLatency("End-to-end latency", Total.EndToEndLatencyUs);
+
+	// Acks are only written for queued redirects, so the listener's own count must agree with ours
+	bool bListenerAgrees = true;
+	if (Listener)
+	{
+		Listener->Stop();
+		const FListenerStats& Stats = Listener->GetStats();
+		printf("Listener accept rate   %.1f conn/s (%llu accepted)\n", Stats.Accepted.load() / WallSeconds,
+			static_cast<unsigned long long>(Stats.Accepted.load()));
+		PrintListenerStats(Stats);
+		bListenerAgrees = Stats.Delivered.load() == Stats.Queued.load()
+			&& Stats.Queued.load() == Total.WellFormedDelivered + Total.FaultsAcked;
+		if (!bListenerAgrees)
+		{
+			printf("Mismatch               listener delivered %llu, senders saw %llu acks\n",
+				static_cast<unsigned long long>(Stats.Delivered.load()),
+				static_cast<unsigned long long>(Total.WellFormedDelivered + Total.FaultsAcked));
+		}
+	}
+
+	const long PeakKiB = PeakMemoryKiB(Options.TargetPid);
+	if (PeakKiB >= 0)
+	{
+		printf("Peak memory            %ld KiB (%s)\n", PeakKiB, Options.TargetPid > 0 ? "target VmHWM" : "this process");
+	}
+	else
+	{
+		printf("Peak memory            unavailable for pid %d\n", Options.TargetPid);
+	}
+
+	// Non-zero exit unless every well-formed message was delivered and no fault was, so the tool can
+	// gate a CI job. Throttled messages count as undelivered: use --no-admission or --rate to gate on loss alone.
+	const bool bAllDelivered = Total.WellFormedDelivered == Total.WellFormedSent && Total.FaultsAcked == 0;
+	return bAllDelivered && bListenerAgrees ? 0 : 1;
+}